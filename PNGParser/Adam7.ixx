@@ -20,7 +20,7 @@ namespace Adam7
 
 namespace Adam7::Internal
 {
-    bool Exists(std::int32_t width, std::int32_t height, size_t passIndex) noexcept
+    constexpr bool Exists(std::int32_t width, std::int32_t height, size_t passIndex) noexcept
     {
         return width > startingCol[passIndex] && height > startingRow[passIndex];
     }
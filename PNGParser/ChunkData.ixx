@@ -151,6 +151,7 @@ namespace ChunkIdentifiers
     constexpr ChunkType internationalTextualData = "iTXt";
     constexpr ChunkType texturalData = "tEXt";
     constexpr ChunkType compressedTextualData = "zTXt";
+    constexpr ChunkType parallelDecodeIndex = "pdIX";
 }
 
 static constexpr auto textDataStrings = std::to_array<std::string_view>({
@@ -262,7 +263,7 @@ struct ChunkTraits<"IHDR">
         std::int8_t filterMethod;
         InterlaceMethod interlaceMethod;
 
-        std::int8_t SubpixelCount() const
+        constexpr std::int8_t SubpixelCount() const
         {
             for(const ColorFormatView& format : standardColorFormats)
             {
@@ -273,32 +274,32 @@ struct ChunkTraits<"IHDR">
             throw std::exception("Unexpected pixel type");
         }
 
-        ImageInfo ToImageInfo() const
+        constexpr ImageInfo ToImageInfo() const
         {
             return { PixelInfo(bitDepth, SubpixelCount()), width, height };
         }
 
-        std::int8_t BitsPerPixel() const
+        constexpr std::int8_t BitsPerPixel() const
         {
             return ToImageInfo().pixelInfo.BitsPerPixel();
         }
 
-        std::int8_t BytesPerPixel() const 
+        constexpr std::int8_t BytesPerPixel() const 
         {
             return ToImageInfo().pixelInfo.BytesPerPixel();
         }
 
-        std::int8_t PixelsPerByte() const 
+        constexpr std::int8_t PixelsPerByte() const 
         {
             return ToImageInfo().pixelInfo.PixelsPerByte();
         }
 
-        std::size_t ScanlineSize() const
+        constexpr std::size_t ScanlineSize() const
         {
             return ToImageInfo().ScanlineSize();
         }
 
-        std::size_t ImageSize() const
+        constexpr std::size_t ImageSize() const
         {
             return ToImageInfo().ImageSize();
         }
@@ -917,6 +918,57 @@ struct ChunkTraits<"zTXt">
     }
 };
 
+/// <summary>
+/// Private chunk written by WritePNG so readers can inflate and defilter the image data in parallel.
+/// Layout, all big endian uint32: the segment count, then per segment its first row, its row count and the offset
+/// from the start of this chunk's length field to the segment's first IDAT chunk. The first segment's data starts
+/// with the zlib header, every other segment is a raw deflate stream whose first scanline does not reference the
+/// previous row. Offsets are only valid for the file as written, so the chunk is not safe to copy
+/// </summary>
+template<>
+struct ChunkTraits<"pdIX">
+{
+    static constexpr ChunkType identifier = "pdIX";
+    static constexpr std::string_view name = "Parallel Decode Index";
+    static constexpr bool is_optional = true;
+    static constexpr bool multiple_allowed = false;
+
+    struct Data
+    {
+        struct Segment
+        {
+            std::uint32_t firstRow;
+            std::uint32_t rowCount;
+            std::uint32_t offset;
+        };
+
+        std::vector<Segment> segments;
+    };
+
+    static constexpr size_t headerSize = sizeof(std::uint32_t);
+    static constexpr size_t segmentSize = sizeof(std::uint32_t) * 3;
+
+    static Data Parse(ChunkDataInputStream& stream, DecodedChunks& chunks)
+    {
+        std::uint32_t segmentCount = stream.ReadNative<std::uint32_t>();
+        if(stream.UnreadSize() % segmentSize > 0 || stream.UnreadSize() / segmentSize != segmentCount)
+            throw std::runtime_error(std::string(identifier.ToString()) + " data does not match the segment count\nSegment count: " + std::to_string(segmentCount) + "\nGiven size: " + std::to_string(stream.ChunkSize()) + "\n");
+
+        Data data;
+        data.segments.reserve(segmentCount);
+        while(stream.HasUnreadData())
+        {
+            Data::Segment segment;
+            segment.firstRow = stream.ReadNative<std::uint32_t>();
+            segment.rowCount = stream.ReadNative<std::uint32_t>();
+            segment.offset = stream.ReadNative<std::uint32_t>();
+            data.segments.push_back(segment);
+        }
+
+        return data;
+    }
+};
+
 template<ChunkType Ty>
 using ChunkContainer = ChunkContainerImpl<Ty, ChunkTraits<Ty>::is_optional, ChunkTraits<Ty>::multiple_allowed>::type;
 
@@ -937,7 +989,8 @@ using StandardChunks = std::tuple<
     ChunkContainer<"tIME">,
     ChunkContainer<"iTXt">,
     ChunkContainer<"tEXt">,
-    ChunkContainer<"zTXt">>;
+    ChunkContainer<"zTXt">,
+    ChunkContainer<"pdIX">>;
 
 struct DecodedChunks
 {
@@ -2,6 +2,7 @@ module;
 
 #include <concepts>
 #include <istream>
+#include <ostream>
 #include <array>
 
 export module PNGParser:ChunkParser;
@@ -55,6 +56,32 @@ Ty ReadNativeBytes(std::istream& stream)
     return std::bit_cast<Ty>(ReadNativeBytes<sizeof(Ty)>(stream));
 };
 
+template<size_t Count>
+void WriteBytes(std::ostream& stream, const Bytes<Count>& bytes)
+{
+    stream.write(reinterpret_cast<const char*>(&bytes), Count);
+}
+
+template<size_t Count>
+void WriteNativeBytes(std::ostream& stream, const Bytes<Count>& bytes)
+{
+    WriteBytes<Count>(stream, ToNativeRepresentation(bytes));
+}
+
+template<class Ty>
+    requires std::integral<Ty> || std::floating_point<Ty> || std::is_enum_v<Ty>
+void WriteBytes(std::ostream& stream, Ty value)
+{
+    WriteBytes<sizeof(Ty)>(stream, std::bit_cast<Bytes<sizeof(Ty)>>(value));
+}
+
+template<class Ty>
+    requires std::integral<Ty> || std::floating_point<Ty> || std::is_enum_v<Ty>
+void WriteNativeBytes(std::ostream& stream, Ty value)
+{
+    WriteNativeBytes<sizeof(Ty)>(stream, std::bit_cast<Bytes<sizeof(Ty)>>(value));
+}
+
 export class ChunkDataInputStream
 {
     std::istream* m_stream;
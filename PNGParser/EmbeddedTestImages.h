@@ -0,0 +1,261 @@
+#pragma once
+
+#include <cstdint>
+
+//Byte arrays of test images, as #embed would produce, for testing compile time decoding
+namespace EmbeddedTestImages
+{
+    //Test Images/basn0g01.png
+    inline constexpr std::uint8_t basn0g01[] =
+    {
+        0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+        0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x01, 0x47,
+        0x59, 0x00, 0x00, 0x00, 0x04, 0x67, 0x41, 0x4d, 0x41, 0x00, 0x01, 0x86, 0xa0, 0x31, 0xe8, 0x96,
+        0x5f, 0x00, 0x00, 0x00, 0x5b, 0x49, 0x44, 0x41, 0x54, 0x78, 0x9c, 0x2d, 0xcc, 0xb1, 0x09, 0x03,
+        0x30, 0x0c, 0x05, 0xd1, 0xeb, 0xd2, 0x04, 0xb2, 0x4a, 0x20, 0x0b, 0x7a, 0x34, 0x6f, 0x90, 0x15,
+        0x3c, 0x82, 0xc1, 0x8d, 0x0a, 0x61, 0x45, 0x07, 0x51, 0xf1, 0xe0, 0x8a, 0x2f, 0xaa, 0xea, 0xd2,
+        0xa4, 0x84, 0x6c, 0xce, 0xa9, 0x25, 0x53, 0x06, 0xe7, 0x53, 0x34, 0x57, 0x12, 0xe2, 0x11, 0xb2,
+        0x21, 0xbf, 0x4b, 0x26, 0x3d, 0x1b, 0x42, 0x73, 0x25, 0x25, 0x5e, 0x8b, 0xda, 0xb2, 0x9e, 0x6f,
+        0x6a, 0xca, 0x30, 0x69, 0x2e, 0x9d, 0x29, 0x61, 0x6e, 0xe9, 0x6f, 0x30, 0x65, 0xf0, 0xbf, 0x1f,
+        0x10, 0x87, 0x49, 0x2f, 0xd0, 0x2f, 0x14, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44,
+        0xae, 0x42, 0x60, 0x82
+    };
+
+    //Test Images/basi3p02.png
+    inline constexpr std::uint8_t basi3p02[] =
+    {
+        0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+        0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x02, 0x03, 0x00, 0x00, 0x01, 0x79, 0x13, 0xa2,
+        0xf1, 0x00, 0x00, 0x00, 0x04, 0x67, 0x41, 0x4d, 0x41, 0x00, 0x01, 0x86, 0xa0, 0x31, 0xe8, 0x96,
+        0x5f, 0x00, 0x00, 0x00, 0x03, 0x73, 0x42, 0x49, 0x54, 0x01, 0x01, 0x01, 0x7c, 0x2e, 0x77, 0x82,
+        0x00, 0x00, 0x00, 0x0c, 0x50, 0x4c, 0x54, 0x45, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
+        0x00, 0x00, 0x00, 0xff, 0x65, 0x3f, 0x2b, 0xba, 0x00, 0x00, 0x00, 0x51, 0x49, 0x44, 0x41, 0x54,
+        0x78, 0x9c, 0x63, 0x78, 0xc7, 0xb0, 0x9b, 0x01, 0x84, 0x5d, 0x18, 0x04, 0xc1, 0xd8, 0xcc, 0x8c,
+        0x21, 0x39, 0x19, 0x4a, 0xde, 0xb8, 0x01, 0x62, 0xf4, 0xf6, 0xa2, 0xb3, 0xbf, 0x2e, 0xf8, 0xba,
+        0x80, 0x81, 0x3f, 0x8a, 0x3f, 0x8a, 0x01, 0xc8, 0xf8, 0xca, 0x00, 0x64, 0xf0, 0xe3, 0x16, 0x43,
+        0x48, 0x20, 0x64, 0x11, 0x4a, 0x48, 0x52, 0xf7, 0x3f, 0x74, 0x15, 0x18, 0x23, 0x18, 0x98, 0x42,
+        0xab, 0xa0, 0x2c, 0x04, 0x03, 0x2a, 0xf1, 0x1f, 0xc1, 0xa0, 0x92, 0x39, 0x00, 0xb4, 0x5a, 0x7d,
+        0xe9, 0x1f, 0x75, 0xe1, 0x03, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60,
+        0x82
+    };
+
+    //Test Images/basn6a16.png
+    inline constexpr std::uint8_t basn6a16[] =
+    {
+        0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+        0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x10, 0x06, 0x00, 0x00, 0x00, 0x23, 0xea, 0xa6,
+        0xb7, 0x00, 0x00, 0x00, 0x04, 0x67, 0x41, 0x4d, 0x41, 0x00, 0x01, 0x86, 0xa0, 0x31, 0xe8, 0x96,
+        0x5f, 0x00, 0x00, 0x0d, 0x22, 0x49, 0x44, 0x41, 0x54, 0x78, 0x9c, 0xdd, 0x99, 0x5f, 0x6c, 0x1c,
+        0xd7, 0x75, 0xc6, 0x7f, 0xf3, 0x8f, 0xb3, 0x4b, 0x72, 0x4d, 0x2e, 0xe5, 0x5a, 0x8e, 0x4b, 0x04,
+        0xa0, 0xac, 0x87, 0x04, 0x91, 0x00, 0xca, 0xb4, 0xdb, 0xd8, 0xc6, 0x52, 0x89, 0x02, 0xcb, 0x4d,
+        0x10, 0x88, 0x16, 0x20, 0x59, 0x2e, 0x52, 0xd4, 0x32, 0x5a, 0xc0, 0x90, 0x5b, 0xc9, 0x8a, 0x94,
+        0x02, 0x5e, 0x71, 0xfd, 0x62, 0x2c, 0xb5, 0x06, 0x5a, 0xc9, 0x8a, 0x0c, 0x28, 0x30, 0x50, 0xc0,
+        0x72, 0x8a, 0x00, 0xb6, 0xe5, 0x42, 0xa1, 0xd1, 0x26, 0x88, 0x5c, 0xd3, 0x29, 0x89, 0x28, 0x89,
+        0x1d, 0x9a, 0x04, 0x44, 0x03, 0x7e, 0x90, 0x44, 0x34, 0x95, 0x1d, 0x4b, 0x90, 0xb8, 0x4b, 0x2f,
+        0xc9, 0xdd, 0xe1, 0xfc, 0xeb, 0xc3, 0x39, 0x77, 0xa9, 0x55, 0x55, 0x34, 0x8f, 0x41, 0x1e, 0x16,
+        0xdf, 0xce, 0x9d, 0x3b, 0x77, 0xee, 0x77, 0xee, 0xbd, 0xe7, 0x7c, 0xe7, 0x8c, 0x95, 0xa6, 0x69,
+        0x0a, 0xd0, 0x7c, 0x17, 0x00, 0x9a, 0x13, 0xed, 0xd8, 0x98, 0xb8, 0x7d, 0xfb, 0x1f, 0xcb, 0x7d,
+        0x2b, 0x4d, 0x1b, 0xff, 0x21, 0x7f, 0x33, 0xdf, 0x80, 0xde, 0xb1, 0xe6, 0x26, 0x7d, 0xf0, 0xff,
+        0xc1, 0xe6, 0xe6, 0xdf, 0xaf, 0xdf, 0x1f, 0x5a, 0x7f, 0xd3, 0x0f, 0x9a, 0xef, 0x66, 0xb6, 0xd5,
+        0x46, 0xdd, 0x35, 0x5b, 0xf0, 0x2c, 0x40, 0x66, 0x2e, 0x33, 0x07, 0xf9, 0x72, 0x5a, 0x96, 0xc6,
+        0x74, 0x4c, 0x30, 0x31, 0xf8, 0x37, 0x82, 0xf1, 0x71, 0xc1, 0x48, 0xdb, 0xc3, 0xbf, 0x17, 0x74,
+        0xf5, 0xda, 0xd1, 0xe7, 0x9d, 0x6f, 0x09, 0x5a, 0x3f, 0x54, 0xd4, 0xfb, 0xec, 0x52, 0x34, 0xef,
+        0xd9, 0xa2, 0xf8, 0xd7, 0x3a, 0xfe, 0x4f, 0x14, 0xf5, 0x7e, 0xf4, 0xf4, 0x2d, 0xef, 0x7b, 0x44,
+        0xf1, 0x90, 0x60, 0xf0, 0x6b, 0x45, 0xbd, 0xdf, 0x1c, 0x55, 0x34, 0xd7, 0x7f, 0xd9, 0x22, 0xbe,
+        0x29, 0x73, 0xa1, 0x5a, 0x82, 0xe6, 0x48, 0x66, 0x1c, 0x6e, 0x32, 0x40, 0xaa, 0x36, 0x12, 0xea,
+        0xd9, 0x52, 0xb6, 0x04, 0xbd, 0xe5, 0x74, 0x58, 0x89, 0x4f, 0x29, 0xde, 0xaf, 0x13, 0x3b, 0xac,
+        0x13, 0xd2, 0x76, 0x6f, 0x52, 0x27, 0xa4, 0xa3, 0xb8, 0xcf, 0x08, 0xda, 0x7a, 0xdf, 0xd6, 0xfb,
+        0xd6, 0xbd, 0x8a, 0x4f, 0xe9, 0xdb, 0xb4, 0x3d, 0x35, 0xe3, 0xdf, 0xa3, 0xf8, 0x44, 0xfb, 0xf8,
+        0x91, 0x19, 0xbf, 0x4f, 0x71, 0x44, 0x09, 0x4f, 0xb5, 0x63, 0x33, 0xab, 0xf8, 0xa8, 0x60, 0x63,
+        0xca, 0x10, 0x6f, 0x94, 0xb3, 0xa3, 0xb5, 0x12, 0x34, 0x37, 0x65, 0xe6, 0x00, 0x82, 0x09, 0x7f,
+        0x1b, 0xb8, 0x6b, 0xa7, 0x24, 0x39, 0xa6, 0x53, 0x51, 0x9b, 0x09, 0xf5, 0xce, 0xe1, 0xce, 0x61,
+        0xc8, 0x97, 0xd3, 0x7e, 0xed, 0xf5, 0x55, 0x35, 0x80, 0xae, 0x60, 0xf4, 0xaf, 0x8a, 0xf3, 0x3a,
+        0xb1, 0x4f, 0xd4, 0x00, 0xb6, 0xa0, 0xf3, 0x45, 0x35, 0xc0, 0x43, 0x4a, 0xfc, 0x0b, 0x3a, 0x9f,
+        0x07, 0x14, 0x75, 0x27, 0xa5, 0xfa, 0x7c, 0xa2, 0x18, 0xff, 0x56, 0xc7, 0x4d, 0x74, 0xdc, 0x3f,
+        0x15, 0x5c, 0xfd, 0x33, 0x25, 0xfc, 0x27, 0x8a, 0xcf, 0x2a, 0xe1, 0xcb, 0x4a, 0x53, 0x9f, 0x5f,
+        0x99, 0x37, 0xc4, 0x57, 0x26, 0x3b, 0x0b, 0xd5, 0x12, 0x34, 0xc7, 0x32, 0xa3, 0x00, 0xcd, 0xd1,
+        0xcc, 0x18, 0x40, 0xf0, 0xaa, 0xff, 0x54, 0xdb, 0x0e, 0x48, 0x74, 0xed, 0x5a, 0x9b, 0x5d, 0x6d,
+        0x27, 0xd4, 0xbb, 0x36, 0x74, 0x6d, 0x80, 0xde, 0x72, 0xba, 0xa8, 0x77, 0xff, 0x4b, 0x27, 0x5a,
+        0xd7, 0x89, 0x5e, 0xd1, 0x89, 0x7e, 0xa4, 0x13, 0x9b, 0x51, 0x43, 0xfc, 0xbb, 0x1a, 0x62, 0x56,
+        0x0d, 0xa1, 0xed, 0x96, 0x62, 0xaa, 0xed, 0x89, 0x5e, 0xc7, 0x8a, 0x91, 0xc1, 0x87, 0x95, 0xb8,
+        0x5e, 0x07, 0xab, 0x4a, 0xf8, 0xba, 0x12, 0x8e, 0x95, 0xe6, 0x82, 0xe0, 0x72, 0x8b, 0xf8, 0xf2,
+        0xe5, 0xae, 0x81, 0x5a, 0x09, 0x1a, 0x53, 0xd9, 0x02, 0xac, 0x19, 0x20, 0xd8, 0xe0, 0x5f, 0x06,
+        0x58, 0x9d, 0xe8, 0xd8, 0xd6, 0x66, 0x80, 0x78, 0x9f, 0x4e, 0x45, 0x4f, 0xb9, 0xd9, 0xec, 0x66,
+        0xcd, 0x85, 0x7a, 0xf7, 0x96, 0xee, 0x2d, 0x90, 0x2f, 0xa7, 0x3f, 0xd5, 0xbb, 0xa7, 0x75, 0xa2,
+        0x15, 0x35, 0x80, 0xae, 0x44, 0x70, 0x5e, 0xd0, 0xd3, 0x76, 0x47, 0xd1, 0x56, 0x97, 0xcb, 0x8f,
+        0x14, 0xbf, 0xa3, 0xe3, 0xe8, 0xfd, 0xf8, 0x03, 0x1d, 0x47, 0xaf, 0x57, 0x15, 0x03, 0x35, 0x7c,
+        0xf3, 0x0d, 0x25, 0xac, 0xed, 0xcb, 0xbf, 0x13, 0x5c, 0x9a, 0x35, 0xc4, 0x97, 0x66, 0xba, 0x07,
+        0xab, 0x25, 0x58, 0x59, 0xe8, 0xec, 0x03, 0x68, 0x4e, 0x66, 0x86, 0x01, 0x82, 0xdf, 0xf8, 0xf7,
+        0x03, 0x04, 0xbf, 0xf6, 0xff, 0x1c, 0x20, 0xfc, 0x81, 0xb7, 0xaf, 0xdd, 0x00, 0xa7, 0x14, 0x75,
+        0x53, 0x9a, 0x53, 0x6e, 0x36, 0xbb, 0x59, 0x73, 0xa1, 0x9e, 0x3b, 0x92, 0x3b, 0x02, 0xbd, 0xe5,
+        0xe4, 0xef, 0xd4, 0x00, 0x3a, 0xc1, 0x70, 0xeb, 0x2d, 0x13, 0xfe, 0x27, 0x41, 0x57, 0xaf, 0xed,
+        0xbd, 0x82, 0xd6, 0xfb, 0x3a, 0x9a, 0x1e, 0x85, 0xe4, 0x55, 0x1d, 0x47, 0xcf, 0x70, 0x78, 0xf8,
+        0x96, 0x71, 0xfe, 0x42, 0x89, 0xeb, 0xf5, 0xf2, 0xbf, 0x08, 0xd6, 0x3f, 0x37, 0xc4, 0xeb, 0x47,
+        0x73, 0xc5, 0x5a, 0x09, 0x96, 0xef, 0xee, 0xfa, 0x0c, 0xa0, 0x11, 0x67, 0x1d, 0x80, 0x60, 0xca,
+        0x2f, 0x00, 0x04, 0xc7, 0xfc, 0xc3, 0x00, 0xe1, 0x66, 0xef, 0x02, 0x40, 0xf8, 0x25, 0xef, 0xe3,
+        0x36, 0x1f, 0x10, 0x6d, 0x57, 0xd4, 0x23, 0xd0, 0x72, 0x3f, 0x7a, 0xca, 0xcd, 0x66, 0x37, 0x6b,
+        0x2e, 0xd4, 0x7b, 0x7a, 0x7a, 0x7a, 0x20, 0x5f, 0x4e, 0xf4, 0xac, 0x46, 0x91, 0xe0, 0xaa, 0xd9,
+        0xaa, 0x0d, 0x41, 0xcf, 0x13, 0x74, 0x1c, 0x35, 0x80, 0xa5, 0x06, 0x48, 0x75, 0x74, 0xdd, 0xca,
+        0x61, 0xa8, 0xc4, 0x03, 0xc1, 0x86, 0x3e, 0xbf, 0xbc, 0xac, 0x34, 0x75, 0x16, 0x8b, 0x2d, 0xe2,
+        0x8b, 0x8b, 0x3d, 0x77, 0x54, 0x4b, 0xb0, 0x5c, 0xe9, 0x2a, 0x02, 0xac, 0xec, 0xed, 0x3c, 0x0d,
+        0xd0, 0xcc, 0x65, 0xea, 0x37, 0x1b, 0x20, 0x1c, 0xf1, 0xc6, 0x01, 0xc2, 0x4d, 0xde, 0x1c, 0x40,
+        0x78, 0xce, 0xdb, 0xde, 0xb6, 0x03, 0x22, 0xf5, 0x01, 0x26, 0xa0, 0x19, 0xbf, 0x6e, 0xdc, 0x9b,
+        0x39, 0xe5, 0x66, 0xb3, 0x9b, 0x35, 0x17, 0xea, 0xf9, 0x7c, 0x3e, 0x0f, 0xbd, 0xe5, 0xe4, 0x49,
+        0x1d, 0x45, 0xbd, 0x74, 0x53, 0x71, 0x45, 0xd1, 0x55, 0xb4, 0x76, 0xaa, 0x01, 0x76, 0xe8, 0x68,
+        0xc6, 0xab, 0xeb, 0xf3, 0x0d, 0xbd, 0x5e, 0x52, 0x5c, 0x54, 0xac, 0x8e, 0x18, 0xe2, 0xd5, 0x6a,
+        0xbe, 0xb7, 0x56, 0x82, 0x7a, 0x3d, 0x97, 0x03, 0x58, 0xa9, 0x74, 0x16, 0x01, 0x9a, 0x6f, 0x64,
+        0xf6, 0x00, 0x04, 0xfd, 0xfe, 0x15, 0x80, 0xd5, 0xc9, 0x8e, 0x61, 0x80, 0x70, 0xcc, 0x1b, 0x05,
+        0x88, 0x7e, 0xee, 0x7e, 0x0d, 0x20, 0x9a, 0x70, 0xdb, 0x7d, 0x80, 0x63, 0x02, 0x98, 0x89, 0xb4,
+        0xc6, 0x20, 0xea, 0xd7, 0x8d, 0x7b, 0x33, 0xa7, 0xdc, 0x6c, 0x76, 0xb3, 0xe6, 0x42, 0x7d, 0xdd,
+        0xdb, 0xeb, 0xde, 0x86, 0x7c, 0x39, 0x3a, 0xa7, 0x84, 0x5e, 0x54, 0x03, 0xe8, 0xca, 0x79, 0x4a,
+        0xd0, 0xd6, 0xfb, 0x89, 0x7a, 0xf5, 0xf0, 0x35, 0x25, 0xfe, 0x57, 0x82, 0xf5, 0xe7, 0x04, 0x6b,
+        0xda, 0xef, 0x46, 0x8b, 0xf8, 0x8d, 0x1d, 0xeb, 0xc6, 0xab, 0x25, 0x58, 0x3c, 0xd1, 0x73, 0x10,
+        0x60, 0x79, 0xb9, 0xab, 0x0b, 0xa0, 0x59, 0xc9, 0x14, 0x01, 0x82, 0x45, 0xbf, 0x07, 0x60, 0x75,
+        0xb5, 0xa3, 0x03, 0x20, 0x0c, 0x3c, 0x1f, 0x20, 0x9a, 0x73, 0x37, 0x01, 0x44, 0x4f, 0xbb, 0xaf,
+        0x00, 0xc4, 0x13, 0x4e, 0xbb, 0x01, 0x6c, 0x5d, 0x0b, 0x23, 0x61, 0x4c, 0x24, 0x37, 0x01, 0xcd,
+        0xf8, 0x75, 0xe3, 0xde, 0xcc, 0xe9, 0x34, 0x9b, 0xdd, 0xac, 0xb9, 0x50, 0x5f, 0xbf, 0x7d, 0xfd,
+        0x76, 0xe8, 0x2d, 0x87, 0x73, 0x6a, 0x00, 0xf5, 0xd2, 0xb5, 0xff, 0xd4, 0xb7, 0xdc, 0xe2, 0x71,
+        0x9a, 0x4d, 0x25, 0xae, 0x71, 0x7e, 0xe1, 0x53, 0xc1, 0xab, 0xef, 0x18, 0xe2, 0x57, 0xcf, 0xad,
+        0x7f, 0xa4, 0x56, 0x82, 0xda, 0x48, 0xef, 0x38, 0xc0, 0x52, 0xb5, 0x3b, 0x0f, 0xd0, 0x68, 0x64,
+        0xb3, 0x00, 0xc1, 0x51, 0xff, 0x08, 0xc0, 0xea, 0x43, 0x1d, 0xe7, 0x01, 0xa2, 0x87, 0xdd, 0x5f,
+        0x00, 0x44, 0x97, 0xdc, 0x7b, 0x01, 0xa2, 0x53, 0xee, 0x3e, 0x80, 0xb8, 0xc7, 0xf9, 0x1c, 0x20,
+        0xf9, 0x67, 0xfb, 0x6f, 0xdb, 0x7c, 0x80, 0xad, 0xa7, 0xd8, 0x68, 0x37, 0x23, 0x61, 0x4c, 0x24,
+        0x37, 0x01, 0xcd, 0xf8, 0x75, 0xe3, 0xde, 0xcc, 0x29, 0x37, 0x9b, 0xdd, 0xac, 0xb9, 0x50, 0xef,
+        0x3f, 0xd4, 0x7f, 0x08, 0xf2, 0xe5, 0xa6, 0x1e, 0xa4, 0xaa, 0x2a, 0x3e, 0xb7, 0x57, 0xcd, 0x55,
+        0x13, 0x34, 0x5e, 0xfc, 0xfa, 0x59, 0xc1, 0x2b, 0x2f, 0x19, 0xe2, 0x57, 0x8e, 0xf7, 0x7f, 0xb7,
+        0x5a, 0x82, 0x85, 0x4f, 0xfb, 0xee, 0x01, 0xa8, 0x3f, 0x97, 0x7b, 0x11, 0xa0, 0x31, 0x93, 0x1d,
+        0x04, 0x08, 0x02, 0xdf, 0x07, 0x08, 0x2b, 0x5e, 0x11, 0x20, 0x7c, 0xc1, 0x7b, 0x1e, 0x20, 0x9a,
+        0x77, 0x07, 0x00, 0xe2, 0xdf, 0x0a, 0x83, 0xe4, 0x09, 0xfb, 0x75, 0x80, 0xf8, 0x27, 0xc2, 0x30,
+        0x99, 0xb0, 0x6f, 0xd9, 0x01, 0xfb, 0x05, 0x8d, 0x68, 0x35, 0xda, 0xcd, 0x48, 0x18, 0x13, 0xc9,
+        0x4d, 0x40, 0x33, 0x7e, 0xdd, 0xb8, 0x37, 0x73, 0xca, 0xcd, 0x66, 0x37, 0x6b, 0x2e, 0xd4, 0x37,
+        0xbe, 0xbc, 0xf1, 0x65, 0xe8, 0x2d, 0x2f, 0x4e, 0x4b, 0xeb, 0x7f, 0x3f, 0xa6, 0xe6, 0x52, 0xc2,
+        0xd7, 0xee, 0x10, 0xbc, 0x78, 0xc0, 0x10, 0xbf, 0xb8, 0x7f, 0xe3, 0xc9, 0x5a, 0x09, 0xae, 0x9f,
+        0xbd, 0x73, 0x27, 0x40, 0xbd, 0x2f, 0xb7, 0x00, 0xd0, 0xf8, 0x65, 0xf6, 0x41, 0x80, 0xe0, 0x59,
+        0xff, 0x04, 0x40, 0x18, 0xca, 0x0c, 0xa2, 0x8a, 0x5b, 0x04, 0x88, 0x3f, 0x70, 0x1e, 0x00, 0x88,
+        0xbf, 0xec, 0x7c, 0x0c, 0x90, 0x9c, 0xb7, 0x1f, 0x04, 0x48, 0xc6, 0xec, 0x51, 0x80, 0x74, 0xb3,
+        0x75, 0x01, 0x20, 0x79, 0xd9, 0xde, 0xdf, 0x66, 0x00, 0x4b, 0xcf, 0xbc, 0x51, 0xeb, 0x2d, 0xd1,
+        0xaa, 0xda, 0xcd, 0x48, 0x18, 0x13, 0xc9, 0x4d, 0x40, 0x33, 0x7e, 0xdd, 0xb8, 0x37, 0x73, 0xca,
+        0xcd, 0x66, 0x37, 0x6b, 0x2e, 0xd4, 0x87, 0x86, 0x86, 0x86, 0x20, 0x5f, 0xbe, 0x7c, 0x49, 0xef,
+        0x56, 0x05, 0xa7, 0x3f, 0x34, 0xc4, 0xa7, 0xa7, 0x87, 0xee, 0xab, 0x96, 0xe0, 0xda, 0x81, 0xbb,
+        0x4e, 0x02, 0x2c, 0x15, 0xba, 0x27, 0x01, 0x9a, 0x5b, 0x33, 0x93, 0x00, 0xe1, 0x6b, 0xf2, 0x86,
+        0xa8, 0xea, 0xe6, 0x01, 0xe2, 0x58, 0x66, 0x90, 0x7c, 0xdf, 0x3e, 0x08, 0x90, 0xac, 0xb3, 0x6f,
+        0x00, 0x24, 0x5f, 0xb5, 0x7f, 0x05, 0x90, 0x4e, 0x59, 0xc3, 0x00, 0xe9, 0x25, 0x61, 0x94, 0x6e,
+        0xb2, 0xe6, 0x00, 0xd2, 0x09, 0xab, 0x7d, 0x07, 0xf0, 0x4d, 0x45, 0x8d, 0xfb, 0x46, 0xad, 0x1b,
+        0xd1, 0x6a, 0xb4, 0x9b, 0x91, 0x30, 0x26, 0x92, 0x9b, 0x80, 0x66, 0xfc, 0xba, 0x71, 0x6f, 0xe6,
+        0x94, 0x9b, 0xcd, 0x6e, 0xd6, 0x5c, 0xa8, 0xef, 0x7e, 0x7c, 0xf7, 0xe3, 0xd0, 0x5b, 0x7e, 0x7c,
+        0x8f, 0x21, 0x7e, 0xe6, 0xcd, 0xdd, 0xbb, 0x6a, 0x25, 0xa8, 0x56, 0xf3, 0x79, 0x80, 0xe0, 0xc7,
+        0xfe, 0x4e, 0x80, 0xa8, 0x26, 0x23, 0xc4, 0x81, 0x93, 0x01, 0x48, 0x46, 0xec, 0x71, 0x80, 0xf4,
+        0xac, 0xf5, 0x18, 0x40, 0x9a, 0xca, 0x0c, 0xd2, 0x8a, 0x55, 0x04, 0xe0, 0x3b, 0x32, 0xc3, 0x74,
+        0xde, 0x1a, 0x00, 0x60, 0x8a, 0x02, 0x40, 0xfa, 0xaa, 0x32, 0x7a, 0x4b, 0x19, 0xfe, 0x94, 0x6f,
+        0xb6, 0xf9, 0x00, 0x54, 0xdb, 0xb5, 0xf2, 0x33, 0x3d, 0x02, 0x2d, 0xb5, 0x6e, 0xb4, 0x96, 0x6a,
+        0x37, 0x23, 0x61, 0x4c, 0x24, 0x37, 0x01, 0xcd, 0xf8, 0xf5, 0x56, 0xbe, 0xa8, 0xa7, 0xdc, 0x6c,
+        0x76, 0xb3, 0xe6, 0x6b, 0xd4, 0x65, 0x84, 0xdd, 0xbb, 0xce, 0xbc, 0x09, 0x90, 0xcf, 0x4b, 0x0f,
+        0xff, 0x40, 0x70, 0x52, 0x0c, 0x28, 0x23, 0x38, 0xa7, 0xe2, 0x67, 0x00, 0xec, 0x72, 0x52, 0x02,
+        0xb0, 0x1e, 0x4b, 0xcf, 0x02, 0x58, 0x96, 0x3c, 0x6f, 0x1d, 0x4d, 0x8f, 0x00, 0x30, 0xcb, 0x20,
+        0x80, 0x55, 0x49, 0xc5, 0x20, 0x93, 0x0c, 0x03, 0x58, 0x4f, 0xa5, 0x22, 0xb6, 0x76, 0xf1, 0x16,
+        0x00, 0xff, 0xc0, 0x3f, 0xde, 0x3e, 0x1b, 0x34, 0x89, 0xa9, 0xc9, 0x05, 0x4c, 0x9a, 0xa2, 0x3b,
+        0xc0, 0x88, 0x56, 0xa3, 0xdd, 0x8c, 0x84, 0x31, 0x91, 0xdc, 0x04, 0x34, 0xe3, 0xd7, 0x8d, 0x7b,
+        0x33, 0xa7, 0x5c, 0x36, 0xfb, 0x99, 0x37, 0x61, 0xf7, 0xae, 0x5a, 0x69, 0xf7, 0x2e, 0xf9, 0x7f,
+        0xe6, 0xad, 0x33, 0x6f, 0xed, 0x7e, 0x1c, 0x60, 0xe8, 0xbe, 0xe9, 0x69, 0x80, 0xbb, 0xde, 0xbb,
+        0xb6, 0x0d, 0xa0, 0x7b, 0x70, 0x69, 0x06, 0x20, 0x33, 0xd9, 0xdc, 0x0a, 0xe0, 0x3d, 0x29, 0x6f,
+        0x70, 0xab, 0x51, 0x1e, 0xc0, 0x71, 0x64, 0x06, 0x76, 0x25, 0x29, 0x02, 0xd8, 0x33, 0xc9, 0x16,
+        0x00, 0x7b, 0x3e, 0x19, 0x00, 0xb0, 0xa6, 0xd2, 0x02, 0x80, 0x35, 0x96, 0x8e, 0x02, 0x58, 0x61,
+        0xea, 0x01, 0x58, 0x13, 0x69, 0xfb, 0x11, 0x48, 0x8c, 0x34, 0xd1, 0x8c, 0xbc, 0x95, 0x98, 0x9a,
+        0xfc, 0xcc, 0xa4, 0x2b, 0xaa, 0xd6, 0x5b, 0xa2, 0xd5, 0x68, 0x37, 0x23, 0x61, 0x4c, 0x24, 0xd7,
+        0x80, 0x66, 0xfc, 0xba, 0xb8, 0xb7, 0xe9, 0x69, 0x18, 0xba, 0xaf, 0x5a, 0xaa, 0x56, 0x21, 0x9f,
+        0x97, 0x5f, 0xb5, 0x0a, 0x43, 0xf7, 0xc9, 0xbd, 0xe9, 0x0f, 0xa7, 0x3f, 0x1c, 0x1a, 0x02, 0xd8,
+        0x78, 0xf2, 0xe2, 0x7e, 0x80, 0x3b, 0x77, 0xca, 0x08, 0xb9, 0x05, 0x19, 0x31, 0x5b, 0x6f, 0xe4,
+        0x00, 0xfc, 0x13, 0x92, 0x09, 0x7a, 0x9e, 0xcc, 0xc0, 0xad, 0x44, 0x45, 0x00, 0xe7, 0x01, 0x99,
+        0xa1, 0x33, 0x1f, 0x0f, 0x00, 0xd8, 0x93, 0x49, 0x01, 0xc0, 0x7e, 0x5d, 0x52, 0x6c, 0xeb, 0x87,
+        0xc2, 0xd0, 0x7e, 0x25, 0x79, 0xba, 0xdd, 0x00, 0x5a, 0x2b, 0x31, 0xa5, 0x08, 0x93, 0x91, 0xb7,
+        0x12, 0x53, 0x35, 0x80, 0x49, 0x53, 0x5a, 0x6a, 0xdd, 0x88, 0x56, 0xdd, 0x01, 0x46, 0xc2, 0x98,
+        0x48, 0x2e, 0x01, 0xed, 0xe2, 0x7e, 0xd8, 0x78, 0xb2, 0x56, 0xba, 0x76, 0x00, 0xee, 0x3a, 0x09,
+        0xc1, 0x8f, 0xc1, 0xdf, 0x09, 0xfe, 0x01, 0x08, 0x4e, 0xc2, 0x5d, 0xef, 0xc1, 0xb5, 0x6d, 0xb0,
+        0xf1, 0xa4, 0xf4, 0xbd, 0x78, 0xe0, 0xe2, 0x81, 0x8d, 0x2f, 0x03, 0x34, 0xe7, 0x33, 0x03, 0x00,
+        0x7d, 0xf7, 0xc8, 0x88, 0xb9, 0x17, 0xe5, 0x0d, 0xd9, 0xc1, 0xc6, 0x0c, 0x80, 0xef, 0xcb, 0x0c,
+        0xbc, 0x63, 0xe1, 0xf7, 0x00, 0xbc, 0xe7, 0xc3, 0x17, 0x00, 0xdc, 0xcb, 0xd1, 0x06, 0x00, 0x27,
+        0x8a, 0xdd, 0x9b, 0x0d, 0xe0, 0x6c, 0x8e, 0x2f, 0x00, 0xd8, 0x49, 0x62, 0xb7, 0xd7, 0x03, 0x0e,
+        0x2a, 0x61, 0x53, 0x83, 0x31, 0xb9, 0x80, 0x51, 0xf9, 0x26, 0x31, 0xbd, 0x25, 0x3f, 0x33, 0x6a,
+        0xdd, 0x88, 0x56, 0xa3, 0xdd, 0x44, 0xc2, 0x5c, 0x39, 0x0e, 0xfd, 0xdf, 0xad, 0x96, 0xae, 0x9f,
+        0x85, 0x3b, 0x77, 0xc2, 0x52, 0x01, 0xba, 0x27, 0xc5, 0x33, 0xb8, 0xbd, 0xf2, 0x8b, 0x6a, 0xd0,
+        0x3d, 0x08, 0x4b, 0x33, 0xd2, 0xe7, 0xfa, 0x59, 0x09, 0x9e, 0x99, 0x01, 0xb8, 0xf2, 0xd2, 0x95,
+        0x97, 0xfa, 0x0f, 0x01, 0x84, 0x8f, 0x78, 0xe7, 0x00, 0x82, 0x11, 0x7f, 0x1c, 0xa0, 0x7b, 0x76,
+        0x69, 0x10, 0x20, 0x9b, 0x95, 0x19, 0xf8, 0x95, 0xa0, 0x08, 0xd0, 0x31, 0xbb, 0xba, 0x05, 0xc0,
+        0x9d, 0x8f, 0x06, 0x00, 0x5c, 0x5b, 0x18, 0xb8, 0xfb, 0xa2, 0x53, 0x00, 0xce, 0xa6, 0x78, 0x0e,
+        0xc0, 0x3e, 0x91, 0x1c, 0x6c, 0xcf, 0x06, 0xd5, 0x07, 0xb4, 0x8a, 0x4f, 0xa6, 0x06, 0x63, 0x4a,
+        0x11, 0x46, 0x09, 0xde, 0x92, 0x9f, 0x99, 0x34, 0xc5, 0xa8, 0x75, 0x11, 0xad, 0x57, 0xcf, 0xc1,
+        0xfa, 0x47, 0x6a, 0xa5, 0x85, 0x4f, 0xa1, 0xef, 0x1e, 0x39, 0x10, 0xb9, 0x05, 0x68, 0x6e, 0x85,
+        0xcc, 0x24, 0xc4, 0x01, 0x38, 0x19, 0x89, 0x15, 0xf1, 0x33, 0xd2, 0xd6, 0xdc, 0x2a, 0x7d, 0xea,
+        0x7d, 0xf2, 0xcc, 0xc2, 0xa7, 0x52, 0xfa, 0xf2, 0xce, 0xc1, 0xd5, 0x77, 0xae, 0xbe, 0xb3, 0x7e,
+        0x3b, 0x40, 0x34, 0xee, 0xee, 0x00, 0x08, 0xdf, 0xf3, 0xbe, 0x0e, 0x6b, 0x92, 0x37, 0x73, 0xb4,
+        0x79, 0x04, 0xc0, 0xef, 0x91, 0x19, 0x76, 0x7c, 0xb4, 0xfa, 0x15, 0x00, 0xef, 0x13, 0x61, 0xe0,
+        0x8e, 0x45, 0x25, 0x00, 0xf7, 0x15, 0x61, 0xe8, 0x4c, 0xc4, 0xed, 0x3e, 0x20, 0xfa, 0xb6, 0xa2,
+        0xc9, 0x05, 0xf4, 0x0c, 0xb7, 0x6a, 0x30, 0x26, 0xbf, 0x33, 0x19, 0xb9, 0x1a, 0xc2, 0xe4, 0x67,
+        0x92, 0xa6, 0xdc, 0xd8, 0x01, 0xeb, 0xc6, 0xab, 0xa5, 0xda, 0x08, 0xf4, 0x8e, 0xcb, 0x81, 0xc8,
+        0xbd, 0x08, 0x8d, 0x5f, 0x42, 0xf6, 0x41, 0x71, 0x91, 0xde, 0x93, 0x90, 0x8c, 0x80, 0x3d, 0x0e,
+        0x76, 0x19, 0x92, 0x92, 0xb4, 0x85, 0xaf, 0x41, 0xb6, 0x0e, 0x8d, 0x9c, 0x3c, 0x53, 0x7f, 0x0e,
+        0x82, 0x11, 0xf0, 0xc7, 0x21, 0x1a, 0x07, 0x77, 0x07, 0xdc, 0x18, 0xb9, 0x31, 0xb2, 0xee, 0x6d,
+        0x80, 0xa4, 0xd7, 0xae, 0x02, 0x44, 0x91, 0xeb, 0xc2, 0x4d, 0x4a, 0x70, 0x8f, 0xf7, 0x06, 0x80,
+        0x7f, 0x25, 0xe8, 0x07, 0xe8, 0x78, 0x5f, 0x18, 0x78, 0xe3, 0x22, 0xd6, 0xdd, 0xaf, 0x45, 0x3f,
+        0x07, 0x70, 0xff, 0x2d, 0xfa, 0x76, 0x9b, 0x01, 0x42, 0x3d, 0xbb, 0xad, 0x72, 0xa3, 0x91, 0xb6,
+        0x5a, 0x7c, 0x32, 0x35, 0x98, 0x56, 0x29, 0x42, 0x33, 0x72, 0x49, 0x4c, 0xab, 0x55, 0xc8, 0xf7,
+        0xd6, 0x4a, 0x8b, 0x27, 0xa0, 0xe7, 0x20, 0x2c, 0x55, 0xa1, 0x3b, 0x0f, 0x8d, 0x19, 0xc8, 0x0e,
+        0x4a, 0xe9, 0xca, 0x3f, 0x01, 0x51, 0x15, 0xdc, 0x3c, 0xa4, 0x67, 0xc1, 0x7a, 0x4c, 0x7e, 0xe9,
+        0x59, 0x70, 0xab, 0x10, 0xe5, 0xa5, 0x4f, 0xf0, 0xac, 0x3c, 0xd3, 0x98, 0x81, 0xee, 0x59, 0x58,
+        0x1a, 0x84, 0xf0, 0x3d, 0xf0, 0xbe, 0x0e, 0x49, 0x2f, 0xd8, 0x55, 0xa8, 0xd6, 0xaa, 0x35, 0xd1,
+        0x0b, 0x49, 0x62, 0xdb, 0xb0, 0xa6, 0x04, 0xa3, 0xd3, 0xee, 0x5e, 0x80, 0xa8, 0xee, 0xe6, 0x00,
+        0xa2, 0x49, 0x77, 0xf8, 0x66, 0x03, 0x78, 0xbf, 0x0b, 0xbf, 0x00, 0xe0, 0x1d, 0x0a, 0x8f, 0xb7,
+        0xf9, 0x80, 0xf0, 0x4b, 0x8a, 0xa6, 0xce, 0x6a, 0xca, 0x8d, 0x5a, 0x75, 0x33, 0xc5, 0x27, 0x53,
+        0x83, 0x91, 0x52, 0xc4, 0xe2, 0x22, 0xf4, 0xdc, 0x51, 0x2d, 0xd5, 0xeb, 0x90, 0xcb, 0xc9, 0x81,
+        0xe8, 0xea, 0x12, 0xcf, 0x90, 0xcd, 0x8a, 0x8b, 0xf4, 0x7d, 0x89, 0x15, 0x9e, 0x27, 0x41, 0xd3,
+        0x71, 0x24, 0xf6, 0x5b, 0x96, 0xfc, 0xd2, 0x54, 0xda, 0xe2, 0x58, 0xfa, 0x84, 0xa1, 0x3c, 0x13,
+        0x04, 0x32, 0x46, 0xa3, 0x21, 0x29, 0x57, 0x47, 0x87, 0xe4, 0x9e, 0xae, 0x2b, 0x49, 0xb8, 0x6d,
+        0xc3, 0xe2, 0xe7, 0x8b, 0x9f, 0xf7, 0xf4, 0x00, 0x24, 0x15, 0xbb, 0x08, 0x90, 0x7c, 0x66, 0xdf,
+        0x0d, 0x10, 0x3b, 0x4e, 0x0c, 0x10, 0x4d, 0xb9, 0x05, 0x00, 0xff, 0x70, 0x70, 0x0c, 0x20, 0x3a,
+        0xee, 0x1e, 0x82, 0xdb, 0xa4, 0xc3, 0xe1, 0x6e, 0x25, 0x6c, 0x0a, 0xcc, 0xa6, 0xce, 0xaa, 0xe9,
+        0xaf, 0xd1, 0xf6, 0x12, 0xd7, 0xeb, 0x47, 0x21, 0x57, 0xac, 0x95, 0x96, 0x2b, 0xd0, 0x55, 0x94,
+        0x7d, 0xd1, 0x59, 0x84, 0x66, 0x05, 0x32, 0x45, 0x08, 0x8e, 0x82, 0x7f, 0x44, 0x62, 0x86, 0x57,
+        0x94, 0x2a, 0x82, 0x5b, 0x84, 0xe4, 0xfb, 0x60, 0x1f, 0x84, 0xb4, 0x02, 0x56, 0x11, 0xac, 0xa3,
+        0x90, 0x1e, 0x01, 0xbb, 0x02, 0x49, 0x11, 0xdc, 0x0a, 0x44, 0x45, 0xf0, 0x8e, 0x41, 0xf8, 0x3d,
+        0xf0, 0x2b, 0x10, 0x14, 0x21, 0x73, 0x14, 0x9a, 0xb7, 0x1b, 0xaf, 0x02, 0x76, 0x11, 0xea, 0x95,
+        0x7a, 0x25, 0x77, 0x04, 0x20, 0x1d, 0x14, 0xcd, 0x9a, 0xf4, 0xd9, 0x0b, 0x00, 0xf1, 0x94, 0x53,
+        0x00, 0x88, 0xcb, 0x4e, 0x09, 0xc0, 0xdf, 0x1c, 0x5c, 0x00, 0x88, 0xf7, 0x39, 0x3f, 0x68, 0x33,
+        0xc0, 0xaa, 0x3a, 0xc1, 0x56, 0x65, 0x5d, 0xe3, 0xbc, 0xa9, 0xb3, 0x4a, 0xb9, 0x71, 0x69, 0x06,
+        0xba, 0x07, 0xab, 0xa5, 0xe5, 0xbb, 0xa1, 0xeb, 0x33, 0x58, 0xd9, 0x0b, 0x9d, 0xa7, 0xc5, 0x33,
+        0x64, 0xf6, 0x88, 0x8b, 0xf4, 0x7b, 0x60, 0xf5, 0x21, 0xe8, 0x38, 0x0f, 0xe1, 0x0b, 0xe0, 0x3d,
+        0x2f, 0xea, 0xc1, 0x79, 0x00, 0x92, 0x75, 0x60, 0xdf, 0x40, 0xf4, 0xe4, 0x8f, 0x80, 0x59, 0x60,
+        0x50, 0x32, 0x8d, 0x64, 0x8b, 0xf4, 0x89, 0x3f, 0x90, 0x67, 0xc2, 0x17, 0xa0, 0x63, 0x16, 0x56,
+        0xb7, 0xc8, 0x98, 0xc1, 0x22, 0x84, 0x7b, 0xc0, 0x7b, 0x03, 0xa2, 0xd3, 0xe0, 0xee, 0x85, 0xe4,
+        0x33, 0xb0, 0xef, 0x86, 0x74, 0x50, 0xc4, 0xfa, 0xd2, 0xec, 0xd2, 0x6c, 0xf7, 0x16, 0x80, 0x74,
+        0xc0, 0xba, 0x0c, 0x90, 0x4c, 0xda, 0xc3, 0x00, 0xc9, 0xcf, 0xec, 0x47, 0x01, 0x92, 0x4d, 0xf6,
+        0x1c, 0xdc, 0xa6, 0x1e, 0x10, 0x68, 0x5c, 0x6f, 0x7d, 0x52, 0xd0, 0xca, 0xba, 0x14, 0x98, 0x97,
+        0x2f, 0x43, 0xd7, 0x40, 0xad, 0xb4, 0xb2, 0x00, 0x9d, 0x7d, 0x72, 0x20, 0xb2, 0x0e, 0x34, 0x73,
+        0x90, 0xa9, 0x43, 0xd0, 0x0f, 0xfe, 0x95, 0x9b, 0xb6, 0xea, 0xc3, 0xe0, 0xfe, 0x42, 0xea, 0x49,
+        0xee, 0x00, 0xc4, 0x5f, 0x06, 0xe7, 0x63, 0x29, 0xb1, 0xda, 0xbf, 0x12, 0x7d, 0x69, 0x0d, 0x80,
+        0x55, 0x81, 0xb4, 0x08, 0xf6, 0x3c, 0x24, 0x03, 0xe0, 0xcc, 0x43, 0x3c, 0x00, 0xee, 0x65, 0x88,
+        0x36, 0x80, 0x3b, 0x0f, 0xd1, 0x00, 0x74, 0x7c, 0x04, 0xab, 0x5f, 0x91, 0x77, 0x04, 0xfd, 0x10,
+        0xd5, 0xc1, 0xcd, 0x41, 0xec, 0x80, 0x13, 0x43, 0xd2, 0x07, 0xf6, 0x02, 0xa4, 0x03, 0x60, 0x5d,
+        0x86, 0xe5, 0xf9, 0xe5, 0xf9, 0xae, 0x0d, 0x00, 0xe9, 0x94, 0x55, 0x68, 0x33, 0x80, 0x66, 0x85,
+        0xc9, 0x31, 0xfb, 0x70, 0x9b, 0x0f, 0x08, 0xb4, 0xe8, 0x69, 0xbe, 0xa5, 0xc8, 0x27, 0x85, 0x95,
+        0x49, 0xe8, 0x2c, 0x54, 0x4b, 0x8d, 0x29, 0xc8, 0x16, 0xa0, 0x39, 0x09, 0x99, 0x61, 0x39, 0x20,
+        0x7e, 0x61, 0x0d, 0x57, 0x27, 0xa1, 0x63, 0x18, 0xc2, 0x00, 0x3c, 0x1f, 0xa2, 0x4b, 0xe0, 0xde,
+        0x2b, 0x32, 0xca, 0xf9, 0x22, 0x24, 0xe7, 0xc1, 0x7e, 0x50, 0x04, 0xb6, 0x35, 0x0c, 0x4c, 0x01,
+        0x05, 0x60, 0x12, 0x18, 0x06, 0x6b, 0x0a, 0xd2, 0x82, 0x24, 0xe1, 0x49, 0x01, 0x9c, 0x08, 0x62,
+        0x57, 0xca, 0x31, 0x51, 0x02, 0xde, 0x27, 0x12, 0x90, 0x3b, 0xde, 0x97, 0xb8, 0x14, 0x4d, 0x82,
+        0x3b, 0x2c, 0x6a, 0xc5, 0x2d, 0x40, 0x3c, 0x05, 0x4e, 0x01, 0x92, 0x49, 0xb0, 0x87, 0xf5, 0x3d,
+        0x05, 0x58, 0x99, 0x5a, 0x99, 0xea, 0x94, 0x6c, 0x70, 0xcc, 0x92, 0x74, 0x58, 0xb3, 0xc1, 0xff,
+        0x55, 0x0f, 0x30, 0x05, 0x0d, 0xf9, 0x88, 0xd4, 0x28, 0x43, 0x76, 0xb4, 0x56, 0x6a, 0x8e, 0x41,
+        0x66, 0x54, 0xcc, 0x92, 0x19, 0x85, 0xe0, 0x37, 0xe0, 0xdf, 0x0f, 0xc1, 0x31, 0xf0, 0x0f, 0x4b,
+        0xac, 0xf0, 0xc6, 0x21, 0x1c, 0x03, 0x6f, 0x14, 0xa2, 0x39, 0x70, 0x37, 0x41, 0x74, 0x0a, 0xdc,
+        0x7d, 0xa2, 0x27, 0xed, 0xd7, 0xe5, 0x6b, 0x83, 0x3d, 0x0a, 0xe9, 0x25, 0x49, 0xb4, 0xd3, 0x57,
+        0x25, 0xdf, 0xb4, 0x9e, 0xd2, 0xff, 0x63, 0x90, 0x8e, 0x6a, 0xdf, 0x27, 0xd6, 0xd0, 0xdd, 0xa7,
+        0x63, 0x8d, 0x41, 0x54, 0xd2, 0x77, 0x8d, 0xac, 0xa1, 0x7f, 0x58, 0xe6, 0x12, 0x97, 0xc1, 0x29,
+        0x41, 0xf2, 0x33, 0xb0, 0x1f, 0x5d, 0xc3, 0x74, 0x0c, 0xac, 0x51, 0x68, 0x8c, 0x35, 0xc6, 0xb2,
+        0x25, 0x80, 0xf4, 0x82, 0x24, 0xfe, 0xe9, 0xb8, 0x35, 0x02, 0x56, 0x9a, 0x66, 0xb6, 0x29, 0xf1,
+        0x09, 0xf3, 0x71, 0x34, 0x73, 0x41, 0x3e, 0x26, 0x66, 0xe7, 0xfe, 0x6f, 0x6c, 0x6e, 0xfe, 0xfd,
+        0xfa, 0xfd, 0xa1, 0xf5, 0x6f, 0x6e, 0x06, 0xf9, 0x34, 0x96, 0xd9, 0xd6, 0x7c, 0xb7, 0x36, 0x6a,
+        0x99, 0x64, 0xb6, 0xf9, 0x2e, 0x64, 0xb6, 0x89, 0x19, 0x6e, 0xc6, 0xc6, 0x04, 0x64, 0x6f, 0xd3,
+        0xfe, 0x47, 0x71, 0xff, 0x1b, 0xf0, 0x3f, 0x65, 0xd8, 0xec, 0xc3, 0xad, 0xdb, 0xb5, 0xf3, 0x00,
+        0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
+    };
+}
\ No newline at end of file
@@ -0,0 +1,355 @@
+module;
+
+#include <cstdint>
+#include <array>
+#include <span>
+#include <vector>
+#include <stdexcept>
+#include <algorithm>
+
+export module PNGParser:Inflate;
+import :PlatformDetection;
+
+//constexpr implementation of zlib (RFC 1950) and deflate (RFC 1951) decompression so that
+//embedded images can be decoded at compile time, zlib is still used for everything at runtime
+namespace Inflate
+{
+    inline constexpr std::size_t maxCodeBits = 15;
+    inline constexpr std::size_t maxLiteralLengthCodes = 288;
+    inline constexpr std::size_t maxDistanceCodes = 30;
+    inline constexpr std::size_t codeLengthCodes = 19;
+    inline constexpr std::uint16_t endOfBlock = 256;
+
+    inline constexpr std::array<std::uint16_t, 29> lengthBase = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+    inline constexpr std::array<std::uint8_t, 29> lengthExtraBits = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+    inline constexpr std::array<std::uint16_t, maxDistanceCodes> distanceBase = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+    inline constexpr std::array<std::uint8_t, maxDistanceCodes> distanceExtraBits = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+    inline constexpr std::array<std::uint8_t, codeLengthCodes> codeLengthOrder = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+    class BitReader
+    {
+    private:
+        std::span<const Byte> m_bytes;
+        std::size_t m_bytePosition = 0;
+        std::uint32_t m_bitBuffer = 0;
+        std::uint32_t m_bitCount = 0;
+
+    public:
+        constexpr BitReader(std::span<const Byte> bytes) :
+            m_bytes(bytes)
+        {
+
+        }
+
+    public:
+        /// <summary>
+        /// Reads bits starting from the least significant bit of the current byte as deflate requires
+        /// </summary>
+        constexpr std::uint32_t ReadBits(std::uint32_t count)
+        {
+            while(m_bitCount < count)
+            {
+                m_bitBuffer |= static_cast<std::uint32_t>(ReadByte()) << m_bitCount;
+                m_bitCount += 8;
+            }
+
+            std::uint32_t bits = m_bitBuffer & ((std::uint32_t{ 1 } << count) - 1);
+            m_bitBuffer >>= count;
+            m_bitCount -= count;
+            return bits;
+        }
+
+        /// <summary>
+        /// Discards the remaining bits of a partially read byte
+        /// </summary>
+        constexpr void AlignToByte() noexcept
+        {
+            m_bitBuffer = 0;
+            m_bitCount = 0;
+        }
+
+        constexpr Byte ReadByte()
+        {
+            if(m_bytePosition >= m_bytes.size())
+                throw std::runtime_error("Unexpected end of compressed data");
+
+            return m_bytes[m_bytePosition++];
+        }
+
+        constexpr std::size_t BytePosition() const noexcept { return m_bytePosition; }
+    };
+
+    /// <summary>
+    /// Canonical huffman code, decoded one bit at a time
+    /// </summary>
+    struct HuffmanCode
+    {
+        std::array<std::uint16_t, maxCodeBits + 1> lengthCounts{};
+        std::array<std::uint16_t, maxLiteralLengthCodes> symbols{};
+
+        constexpr HuffmanCode(std::span<const std::uint8_t> codeLengths)
+        {
+            for(std::uint8_t length : codeLengths)
+            {
+                lengthCounts[length]++;
+            }
+
+            std::int32_t codesLeft = 1;
+            for(std::size_t length = 1; length <= maxCodeBits; length++)
+            {
+                codesLeft <<= 1;
+                codesLeft -= lengthCounts[length];
+                if(codesLeft < 0)
+                    throw std::runtime_error("Over-subscribed huffman code");
+            }
+
+            std::array<std::uint16_t, maxCodeBits + 1> offsets{};
+            for(std::size_t length = 1; length < maxCodeBits; length++)
+            {
+                offsets[length + 1] = offsets[length] + lengthCounts[length];
+            }
+
+            for(std::size_t symbol = 0; symbol < codeLengths.size(); symbol++)
+            {
+                if(codeLengths[symbol] != 0)
+                    symbols[offsets[codeLengths[symbol]]++] = static_cast<std::uint16_t>(symbol);
+            }
+        }
+
+        constexpr std::uint16_t Decode(BitReader& reader) const
+        {
+            std::int32_t code = 0;
+            std::int32_t first = 0;
+            std::int32_t index = 0;
+            for(std::size_t length = 1; length <= maxCodeBits; length++)
+            {
+                code |= reader.ReadBits(1);
+                std::int32_t count = lengthCounts[length];
+                if(code - count < first)
+                    return symbols[index + (code - first)];
+
+                index += count;
+                first = (first + count) << 1;
+                code <<= 1;
+            }
+
+            throw std::runtime_error("Invalid huffman code");
+        }
+    };
+
+    constexpr HuffmanCode FixedLiteralLengthCode()
+    {
+        std::array<std::uint8_t, maxLiteralLengthCodes> codeLengths{};
+        for(std::size_t i = 0; i < codeLengths.size(); i++)
+        {
+            if(i < 144)
+                codeLengths[i] = 8;
+            else if(i < 256)
+                codeLengths[i] = 9;
+            else if(i < 280)
+                codeLengths[i] = 7;
+            else
+                codeLengths[i] = 8;
+        }
+        return HuffmanCode(codeLengths);
+    }
+
+    constexpr HuffmanCode FixedDistanceCode()
+    {
+        std::array<std::uint8_t, maxDistanceCodes> codeLengths{};
+        for(std::uint8_t& length : codeLengths)
+        {
+            length = 5;
+        }
+        return HuffmanCode(codeLengths);
+    }
+
+    constexpr void InflateStoredBlock(BitReader& reader, std::vector<Byte>& output)
+    {
+        reader.AlignToByte();
+
+        std::uint16_t length = reader.ReadByte();
+        length |= reader.ReadByte() << 8;
+        std::uint16_t lengthComplement = reader.ReadByte();
+        lengthComplement |= reader.ReadByte() << 8;
+
+        if(length != static_cast<std::uint16_t>(~lengthComplement))
+            throw std::runtime_error("Stored block length does not match its complement");
+
+        for(std::uint16_t i = 0; i < length; i++)
+        {
+            output.push_back(reader.ReadByte());
+        }
+    }
+
+    constexpr void InflateCodes(BitReader& reader, std::vector<Byte>& output, const HuffmanCode& literalLengthCode, const HuffmanCode& distanceCode)
+    {
+        for(std::uint16_t symbol = literalLengthCode.Decode(reader); symbol != endOfBlock; symbol = literalLengthCode.Decode(reader))
+        {
+            if(symbol < endOfBlock)
+            {
+                output.push_back(static_cast<Byte>(symbol));
+                continue;
+            }
+
+            std::size_t lengthIndex = symbol - endOfBlock - 1;
+            if(lengthIndex >= lengthBase.size())
+                throw std::runtime_error("Invalid length symbol");
+
+            std::size_t length = lengthBase[lengthIndex] + reader.ReadBits(lengthExtraBits[lengthIndex]);
+
+            std::size_t distanceIndex = distanceCode.Decode(reader);
+            if(distanceIndex >= distanceBase.size())
+                throw std::runtime_error("Invalid distance symbol");
+
+            std::size_t distance = distanceBase[distanceIndex] + reader.ReadBits(distanceExtraBits[distanceIndex]);
+            if(distance > output.size())
+                throw std::runtime_error("Distance refers to data before the start of the stream");
+
+            //Copies have to go byte by byte as the source is allowed to overlap what is being written
+            for(std::size_t start = output.size() - distance, i = 0; i < length; i++)
+            {
+                output.push_back(output[start + i]);
+            }
+        }
+    }
+
+    constexpr void InflateDynamicBlock(BitReader& reader, std::vector<Byte>& output)
+    {
+        std::size_t literalLengthCount = reader.ReadBits(5) + 257;
+        std::size_t distanceCount = reader.ReadBits(5) + 1;
+        std::size_t codeLengthCount = reader.ReadBits(4) + 4;
+
+        if(literalLengthCount > 286 || distanceCount > maxDistanceCodes)
+            throw std::runtime_error("Too many codes in dynamic block");
+
+        std::array<std::uint8_t, codeLengthCodes> codeLengthLengths{};
+        for(std::size_t i = 0; i < codeLengthCount; i++)
+        {
+            codeLengthLengths[codeLengthOrder[i]] = static_cast<std::uint8_t>(reader.ReadBits(3));
+        }
+        HuffmanCode codeLengthCode{ codeLengthLengths };
+
+        std::array<std::uint8_t, maxLiteralLengthCodes + maxDistanceCodes> codeLengths{};
+        for(std::size_t i = 0; i < literalLengthCount + distanceCount;)
+        {
+            std::uint16_t symbol = codeLengthCode.Decode(reader);
+            if(symbol < 16)
+            {
+                codeLengths[i++] = static_cast<std::uint8_t>(symbol);
+                continue;
+            }
+
+            std::uint8_t repeatedLength = 0;
+            std::size_t repeatCount = 0;
+            switch(symbol)
+            {
+            case 16:
+                if(i == 0)
+                    throw std::runtime_error("Repeat code with no previous length");
+                repeatedLength = codeLengths[i - 1];
+                repeatCount = 3 + reader.ReadBits(2);
+                break;
+            case 17:
+                repeatCount = 3 + reader.ReadBits(3);
+                break;
+            default:
+                repeatCount = 11 + reader.ReadBits(7);
+                break;
+            }
+
+            if(i + repeatCount > literalLengthCount + distanceCount)
+                throw std::runtime_error("Repeated code lengths exceed the code count");
+
+            for(; repeatCount > 0; repeatCount--)
+            {
+                codeLengths[i++] = repeatedLength;
+            }
+        }
+
+        if(codeLengths[endOfBlock] == 0)
+            throw std::runtime_error("Dynamic block is missing an end of block code");
+
+        HuffmanCode literalLengthCode{ std::span(codeLengths).first(literalLengthCount) };
+        HuffmanCode distanceCode{ std::span(codeLengths).subspan(literalLengthCount, distanceCount) };
+        InflateCodes(reader, output, literalLengthCode, distanceCode);
+    }
+
+    constexpr std::uint32_t Adler32(std::span<const Byte> bytes) noexcept
+    {
+        constexpr std::uint32_t modulo = 65521;
+        //Largest number of bytes which can be summed before the sums could overflow
+        constexpr std::size_t maxRunLength = 5552;
+
+        std::uint32_t a = 1;
+        std::uint32_t b = 0;
+        while(!bytes.empty())
+        {
+            std::span<const Byte> run = bytes.first(std::min(bytes.size(), maxRunLength));
+            for(Byte byte : run)
+            {
+                a += byte;
+                b += a;
+            }
+            a %= modulo;
+            b %= modulo;
+            bytes = bytes.subspan(run.size());
+        }
+
+        return (b << 16) | a;
+    }
+
+    /// <summary>
+    /// Decompresses a full zlib stream
+    /// </summary>
+    /// <param name="expectedSize">Size of the decompressed data, used to reserve the output</param>
+    constexpr std::vector<Byte> Decompress(std::span<const Byte> compressedBytes, std::size_t expectedSize)
+    {
+        BitReader reader{ compressedBytes };
+
+        Byte compressionInfo = reader.ReadByte();
+        Byte flags = reader.ReadByte();
+
+        if((compressionInfo & 0x0f) != 8 || (compressionInfo >> 4) > 7)
+            throw std::runtime_error("Unsupported zlib compression method");
+        if(((compressionInfo << 8) | flags) % 31 != 0)
+            throw std::runtime_error("zlib header check failed");
+        if(flags & 0x20)
+            throw std::runtime_error("zlib preset dictionaries are not supported");
+
+        std::vector<Byte> output;
+        output.reserve(expectedSize);
+
+        bool finalBlock = false;
+        while(!finalBlock)
+        {
+            finalBlock = reader.ReadBits(1);
+            switch(reader.ReadBits(2))
+            {
+            case 0:
+                InflateStoredBlock(reader, output);
+                break;
+            case 1:
+                InflateCodes(reader, output, FixedLiteralLengthCode(), FixedDistanceCode());
+                break;
+            case 2:
+                InflateDynamicBlock(reader, output);
+                break;
+            default:
+                throw std::runtime_error("Invalid deflate block type");
+            }
+        }
+
+        reader.AlignToByte();
+        std::uint32_t checksum = 0;
+        for(size_t i = 0; i < 4; i++)
+        {
+            checksum = (checksum << 8) | reader.ReadByte();
+        }
+
+        if(checksum != Adler32(output))
+            throw std::runtime_error("zlib checksum does not match decompressed data");
+
+        return output;
+    }
+}
\ No newline at end of file
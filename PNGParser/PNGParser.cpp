@@ -15,6 +15,7 @@ module;
 #include <numeric>
 #include <limits>
 #include <variant>
+#include <streambuf>
 
 module PNGParser;
 import :ScopeGuard;
@@ -170,6 +171,9 @@ private:
         case "zTXt"_ct:
             ParseChunkData<"zTXt">(chunkStream);
             break;
+        case "pdIX"_ct:
+            ParseChunkData<"pdIX">(chunkStream);
+            break;
         default:
             throw UnknownChunkError{ type };
             break;
@@ -578,6 +582,46 @@ DeinterlacedImage ColorImage(DeinterlacedImage image, ChunkData<"IHDR"> header,
     return image;
 }
 
+/// <summary>
+/// Read only stream buffer over bytes already in memory, lets ParsePNG read them without copying
+/// </summary>
+class ByteSpanStreamBuffer : public std::streambuf
+{
+public:
+    ByteSpanStreamBuffer(std::span<const Byte> bytes)
+    {
+        char* begin = const_cast<char*>(reinterpret_cast<const char*>(bytes.data()));
+        setg(begin, begin, begin + bytes.size());
+    }
+
+protected:
+    pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode which) override
+    {
+        if(!(which & std::ios_base::in))
+            return pos_type(off_type(-1));
+
+        char* position = (direction == std::ios_base::beg) ? eback() : (direction == std::ios_base::cur) ? gptr() : egptr();
+        if(offset < eback() - position || offset > egptr() - position)
+            return pos_type(off_type(-1));
+
+        setg(eback(), position + offset, egptr());
+        return pos_type(gptr() - eback());
+    }
+
+    pos_type seekpos(pos_type position, std::ios_base::openmode which) override
+    {
+        return seekoff(off_type(position), std::ios_base::beg, which);
+    }
+};
+
+Image2 ParsePNG(std::span<const Byte> bytes)
+{
+    ByteSpanStreamBuffer buffer{ bytes };
+    std::istream stream{ &buffer };
+    stream.exceptions(std::ios_base::badbit | std::ios_base::failbit);
+    return ParsePNG(stream);
+}
+
 Image2 ParsePNG(std::istream& stream)
 {
     VerifySignature(stream);
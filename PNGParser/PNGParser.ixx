@@ -10,6 +10,7 @@ module;
 #include <string>
 #include <vector>
 #include <istream>
+#include <ostream>
 #include <cassert>
 
 export module PNGParser;
@@ -19,6 +20,7 @@ export import :ChunkData;
 import :PNGFilter0;
 import :Image;
 import :Adam7;
+export import :StaticDecoder;
 
 export struct Image2
 {
@@ -30,6 +32,56 @@ export struct Image2
 };
 
 export Image2 ParsePNG(std::istream& stream);
+export Image2 ParsePNG(std::span<const Byte> bytes);
+
+export struct PNGWriteOptions
+{
+    /// <summary>
+    /// zlib compression level, 0 to 9
+    /// </summary>
+    int compressionLevel = 6;
+
+    /// <summary>
+    /// Threads used to filter and compress the image, 0 uses one per hardware thread
+    /// </summary>
+    unsigned int threadCount = 0;
+
+    /// <summary>
+    /// Writes a private pdIX chunk indexing where each compressed segment starts so readers can inflate segments in parallel.
+    /// Segments are then compressed independently, otherwise each segment is primed with the tail of the previous one
+    /// </summary>
+    bool emitSplitIndex = true;
+};
+
+/// <summary>
+/// Writes an 8 bit per subpixel image, bitDepth of 8, 16, 24 and 32 are written as greyscale, greyscale with alpha, true color and true color with alpha
+/// </summary>
+export void WritePNG(std::ostream& stream, const Image2& image, const PNGWriteOptions& options = {});
+
+/// <summary>
+/// Largest decoded image size in bytes that ParseEmbeddedPNG will decode at compile time
+/// </summary>
+export inline constexpr std::size_t embeddedDecodeSizeLimit = 16 * 1024;
+
+/// <summary>
+/// Decodes a PNG embedded in the binary, at compile time if the decoded image fits in DecodeSizeLimit, otherwise at runtime.
+/// The signature and header are always checked at compile time
+/// </summary>
+export template<const auto& PNGBytes, std::size_t DecodeSizeLimit = embeddedDecodeSizeLimit>
+Image2 ParseEmbeddedPNG()
+{
+    constexpr ChunkData<"IHDR"> header = StaticDecoder::ReadHeader(PNGBytes);
+
+    if constexpr(StaticDecoder::DecodedImageSize(header) <= DecodeSizeLimit)
+    {
+        static constexpr auto image = ParseStaticPNG<PNGBytes>();
+        return { image.width, image.height, std::vector<Byte>(image.imageBytes.begin(), image.imageBytes.end()), image.pitch, image.bitDepth };
+    }
+    else
+    {
+        return ParsePNG(std::span<const Byte>(PNGBytes));
+    }
+}
 
 std::size_t DecompressedImageSize(const ChunkData<"IHDR">& header)
 {
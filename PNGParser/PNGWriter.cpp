@@ -0,0 +1,359 @@
+module;
+
+#include <array>
+#include <bit>
+#include <functional>
+#include <cstdint>
+#include <algorithm>
+#include <vector>
+#include <span>
+#include <ostream>
+#include <future>
+#include <thread>
+#include <stdexcept>
+#include <string>
+#include <concepts>
+#include <limits>
+#include <zlib.h>
+
+module PNGParser;
+import :ScopeGuard;
+
+//Images are written in horizontal segments which are filtered and deflated on separate threads, pigz style.
+//Every segment but the last ends on a byte boundary without a final block, so the raw deflate streams can be
+//concatenated back to back and wrapped in a single zlib header and a combined adler32
+namespace Writer
+{
+    //Segments smaller than this compress noticeably worse than a single stream
+    constexpr std::size_t minSegmentSize = 128 * 1024;
+    constexpr std::size_t dictionarySize = 32 * 1024;
+    //zlib takes sizes as uInt and z_off_t, both 32 bit on Windows, so no segment may get near 2 GiB
+    constexpr std::size_t maxSegmentSize = 1024 * 1024 * 1024;
+    static_assert(maxSegmentSize <= std::numeric_limits<uInt>::max() && maxSegmentSize <= std::numeric_limits<z_off_t>::max());
+
+    constexpr std::size_t chunkOverheadSize = 12;
+
+    struct Segment
+    {
+        std::uint32_t firstRow;
+        std::uint32_t rowCount;
+        std::vector<Byte> filteredBytes;
+        std::vector<Byte> compressedBytes;
+        uLong adler;
+    };
+
+    ColorType ColorTypeFromBitDepth(int bitDepth)
+    {
+        switch(bitDepth)
+        {
+        case 8:
+            return ColorType::GreyScale;
+        case 16:
+            return ColorType::GreyscaleWithAlpha;
+        case 24:
+            return ColorType::TrueColor;
+        case 32:
+            return ColorType::TruecolorWithAlpha;
+        }
+
+        throw std::runtime_error("Unsupported bit depth: " + std::to_string(bitDepth));
+    }
+
+    /// <summary>
+    /// Sum of the filtered bytes as signed differences, the smaller it is the better the scanline tends to compress
+    /// </summary>
+    std::uint32_t FilterCost(std::span<const Byte> filteredScanline) noexcept
+    {
+        std::uint32_t cost = 0;
+        for(Byte byte : filteredScanline)
+        {
+            cost += (byte < 128) ? byte : 256 - byte;
+        }
+        return cost;
+    }
+
+    void FilterScanline(std::span<const Byte> scanline, std::span<const Byte> previousScanline, std::size_t bytesPerPixel, Filter0::FilterFunctionSignature filter, std::span<Byte> filteredScanline) noexcept
+    {
+        for(size_t i = 0; i < scanline.size(); i++)
+        {
+            Byte a = (i >= bytesPerPixel) ? scanline[i - bytesPerPixel] : 0;
+            Byte b = previousScanline.empty() ? 0 : previousScanline[i];
+            Byte c = (i >= bytesPerPixel && !previousScanline.empty()) ? previousScanline[i - bytesPerPixel] : 0;
+            filteredScanline[i] = filter(scanline[i], a, b, c);
+        }
+    }
+
+    /// <summary>
+    /// Applies filter method 0 to the segment's rows, choosing the filter type per scanline with the smallest FilterCost
+    /// </summary>
+    /// <param name="independent">Keeps the first scanline from depending on the previous segment so it can be defiltered on its own</param>
+    std::vector<Byte> FilterSegment(const Image2& image, std::uint32_t firstRow, std::uint32_t rowCount, bool independent)
+    {
+        const std::size_t bytesPerPixel = image.bitDepth / 8;
+        const std::size_t scanlineSize = image.width * bytesPerPixel;
+        const std::size_t filteredScanlineSize = scanlineSize + Filter0::filterByteCount;
+
+        std::vector<Byte> filteredBytes(filteredScanlineSize * rowCount);
+        std::vector<Byte> candidate(scanlineSize);
+
+        for(std::uint32_t y = firstRow; y < firstRow + rowCount; y++)
+        {
+            std::span<const Byte> scanline = std::span(image.imageBytes).subspan(static_cast<std::size_t>(y) * image.pitch, scanlineSize);
+            std::span<const Byte> previousScanline;
+            if(y > 0 && !(independent && y == firstRow))
+                previousScanline = std::span(image.imageBytes).subspan(static_cast<std::size_t>(y - 1) * image.pitch, scanlineSize);
+
+            std::span<Byte> output = std::span(filteredBytes).subspan((y - firstRow) * filteredScanlineSize, filteredScanlineSize);
+
+            //Filters which read the previous scanline are pointless without one
+            const size_t filterCount = previousScanline.empty() ? 2 : Filter0::numFilterFunctions;
+
+            std::uint32_t bestCost = std::numeric_limits<std::uint32_t>::max();
+            for(size_t filterType = 0; filterType < filterCount; filterType++)
+            {
+                FilterScanline(scanline, previousScanline, bytesPerPixel, Filter0::filterFunctions[filterType], candidate);
+
+                if(std::uint32_t cost = FilterCost(candidate); cost < bestCost)
+                {
+                    bestCost = cost;
+                    output[0] = static_cast<Byte>(filterType);
+                    std::copy(candidate.begin(), candidate.end(), output.begin() + Filter0::filterByteCount);
+                }
+            }
+        }
+
+        return filteredBytes;
+    }
+
+    /// <summary>
+    /// Deflates a segment as a raw deflate stream. Only the last segment is finished, the rest end with a sync flush
+    /// so the next segment's stream can be appended directly after it
+    /// </summary>
+    /// <param name="dictionary">Uncompressed bytes preceding the segment which matches may refer back to</param>
+    std::vector<Byte> CompressSegment(std::span<const Byte> filteredBytes, std::span<const Byte> dictionary, int compressionLevel, bool lastSegment)
+    {
+        z_stream zstream = {};
+        if(deflateInit2(&zstream, compressionLevel, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+            throw std::runtime_error("zstream failed to initialize");
+
+        ScopeGuard endDeflate = [&zstream]
+        {
+            deflateEnd(&zstream);
+        };
+
+        if(!dictionary.empty() && deflateSetDictionary(&zstream, dictionary.data(), static_cast<uInt>(dictionary.size())) != Z_OK)
+            throw std::runtime_error("zstream failed to set dictionary");
+
+        //deflateBound assumes Z_FINISH, a sync flush adds an empty stored block on top of that
+        constexpr std::size_t syncFlushSize = 6;
+
+        std::vector<Byte> compressedBytes;
+        compressedBytes.resize(deflateBound(&zstream, static_cast<uLong>(filteredBytes.size())) + syncFlushSize);
+
+        zstream.next_in = const_cast<Byte*>(filteredBytes.data());
+        zstream.avail_in = static_cast<uInt>(filteredBytes.size());
+        zstream.next_out = compressedBytes.data();
+        zstream.avail_out = static_cast<uInt>(compressedBytes.size());
+
+        int result = deflate(&zstream, lastSegment ? Z_FINISH : Z_SYNC_FLUSH);
+        if(result != (lastSegment ? Z_STREAM_END : Z_OK) || zstream.avail_in != 0)
+            throw std::runtime_error("Failed to compress image segment");
+
+        compressedBytes.resize(zstream.total_out);
+        return compressedBytes;
+    }
+
+    std::vector<Segment> SplitIntoSegments(const Image2& image, unsigned int threadCount)
+    {
+        const std::size_t filteredScanlineSize = image.width * static_cast<std::size_t>(image.bitDepth / 8) + Filter0::filterByteCount;
+        const std::size_t filteredSize = filteredScanlineSize * image.height;
+        if(filteredScanlineSize > maxSegmentSize)
+            throw std::runtime_error("Scanline is too large to compress");
+
+        //As many segments as there are threads if they are worth splitting, but always enough to keep each under the maximum size
+        const std::size_t maxRowsPerSegment = maxSegmentSize / filteredScanlineSize;
+        const std::size_t requiredSegmentCount = (image.height + maxRowsPerSegment - 1) / maxRowsPerSegment;
+        const std::size_t segmentCount = std::max(requiredSegmentCount, std::clamp<std::size_t>(filteredSize / minSegmentSize, 1, std::min<std::size_t>(threadCount, image.height)));
+
+        std::vector<Segment> segments(segmentCount);
+        std::uint32_t firstRow = 0;
+        for(size_t i = 0; i < segmentCount; i++)
+        {
+            segments[i].firstRow = firstRow;
+            segments[i].rowCount = static_cast<std::uint32_t>(image.height / segmentCount + (i < image.height % segmentCount));
+            firstRow += segments[i].rowCount;
+        }
+        return segments;
+    }
+
+    /// <summary>
+    /// Runs the function on every segment, one thread per segment
+    /// </summary>
+    template<std::invocable<Segment&, size_t> Func>
+    void ForEachSegment(std::vector<Segment>& segments, Func func)
+    {
+        std::vector<std::future<void>> tasks;
+        tasks.reserve(segments.size());
+        for(size_t i = 0; i < segments.size(); i++)
+        {
+            tasks.push_back(std::async(std::launch::async, func, std::ref(segments[i]), i));
+        }
+
+        for(std::future<void>& task : tasks)
+        {
+            task.get();
+        }
+    }
+
+    void WriteChunk(std::ostream& stream, ChunkType type, std::span<const Byte> data)
+    {
+        WriteNativeBytes(stream, static_cast<std::uint32_t>(data.size()));
+        WriteBytes(stream, std::bit_cast<Bytes<4>>(type.identifier.string));
+        stream.write(reinterpret_cast<const char*>(data.data()), data.size());
+
+        uLong crc = crc32(0, reinterpret_cast<const Byte*>(type.identifier.string.data()), static_cast<uInt>(type.identifier.string.size()));
+        //crc32 treats a null buffer as a request for the initial value, which an empty span may hand it
+        if(!data.empty())
+            crc = crc32(crc, data.data(), static_cast<uInt>(data.size()));
+        WriteNativeBytes(stream, static_cast<std::uint32_t>(crc));
+    }
+
+    /// <summary>
+    /// Splits data into as many IDAT chunks as needed
+    /// </summary>
+    void WriteDataChunks(std::ostream& stream, std::span<const Byte> data)
+    {
+        do
+        {
+            std::span<const Byte> chunkData = data.first(std::min(data.size(), ChunkTraits<"IDAT">::maxSize));
+            WriteChunk(stream, "IDAT", chunkData);
+            data = data.subspan(chunkData.size());
+        } while(!data.empty());
+    }
+
+    /// <summary>
+    /// Size of the IDAT chunks WriteDataChunks writes for the data, chunk overhead included
+    /// </summary>
+    std::size_t DataChunksSize(std::size_t dataSize) noexcept
+    {
+        std::size_t chunkCount = std::max<std::size_t>(1, (dataSize + ChunkTraits<"IDAT">::maxSize - 1) / ChunkTraits<"IDAT">::maxSize);
+        return dataSize + chunkCount * chunkOverheadSize;
+    }
+
+    Bytes<2> ZlibHeader(int compressionLevel) noexcept
+    {
+        //Deflate with a 32K window
+        const Byte compressionInfo = 0x78;
+        const Byte levelFlag = (compressionLevel < 2) ? 0 : (compressionLevel < 6) ? 1 : (compressionLevel == 6) ? 2 : 3;
+
+        Byte flags = static_cast<Byte>(levelFlag << 6);
+        flags += 31 - ((compressionInfo << 8) | flags) % 31;
+        return { compressionInfo, flags };
+    }
+
+    /// <summary>
+    /// pdIX chunk data, see ChunkTraits<"pdIX"> for the layout
+    /// </summary>
+    std::vector<Byte> SplitIndex(std::span<const std::size_t> dataChunkSizes, std::span<const Segment> segments)
+    {
+        std::vector<Byte> data;
+        auto append = [&data](std::uint32_t value)
+        {
+            Bytes<4> bytes = ToNativeRepresentation(std::bit_cast<Bytes<4>>(value));
+            data.insert(data.end(), bytes.begin(), bytes.end());
+        };
+
+        append(static_cast<std::uint32_t>(segments.size()));
+
+        std::size_t offset = chunkOverheadSize + ChunkTraits<"pdIX">::headerSize + ChunkTraits<"pdIX">::segmentSize * segments.size();
+        for(size_t i = 0; i < segments.size(); i++)
+        {
+            if(offset > std::numeric_limits<std::uint32_t>::max())
+                throw std::runtime_error("Image data is too large to index");
+
+            append(segments[i].firstRow);
+            append(segments[i].rowCount);
+            append(static_cast<std::uint32_t>(offset));
+            offset += dataChunkSizes[i];
+        }
+
+        return data;
+    }
+}
+
+void WritePNG(std::ostream& stream, const Image2& image, const PNGWriteOptions& options)
+{
+    const ColorType colorType = Writer::ColorTypeFromBitDepth(image.bitDepth);
+    if(image.width <= 0 || image.height <= 0)
+        throw std::runtime_error("Image dimensions must be positive");
+    if(image.pitch < image.width * image.bitDepth / 8 || image.imageBytes.size() < static_cast<std::size_t>(image.pitch) * image.height)
+        throw std::runtime_error("Image bytes do not cover the image dimensions");
+
+    const unsigned int threadCount = (options.threadCount > 0) ? options.threadCount : std::max(1u, std::thread::hardware_concurrency());
+    std::vector<Writer::Segment> segments = Writer::SplitIntoSegments(image, threadCount);
+    const bool emitSplitIndex = options.emitSplitIndex && segments.size() > 1;
+
+    Writer::ForEachSegment(segments, [&](Writer::Segment& segment, size_t i)
+    {
+        segment.filteredBytes = Writer::FilterSegment(image, segment.firstRow, segment.rowCount, emitSplitIndex);
+    });
+
+    Writer::ForEachSegment(segments, [&](Writer::Segment& segment, size_t i)
+    {
+        std::span<const Byte> dictionary;
+        if(i > 0 && !emitSplitIndex)
+        {
+            const std::vector<Byte>& previousBytes = segments[i - 1].filteredBytes;
+            dictionary = std::span(previousBytes).last(std::min(previousBytes.size(), Writer::dictionarySize));
+        }
+
+        segment.compressedBytes = Writer::CompressSegment(segment.filteredBytes, dictionary, options.compressionLevel, i == segments.size() - 1);
+        segment.adler = adler32(adler32(0, nullptr, 0), segment.filteredBytes.data(), static_cast<uInt>(segment.filteredBytes.size()));
+    });
+
+    uLong adler = adler32(0, nullptr, 0);
+    for(const Writer::Segment& segment : segments)
+    {
+        adler = adler32_combine(adler, segment.adler, static_cast<z_off_t>(segment.filteredBytes.size()));
+    }
+
+    //The zlib header and checksum wrap the concatenated segments, so they go into the first and last segment's data
+    const Bytes<2> zlibHeader = Writer::ZlibHeader(options.compressionLevel);
+    const Bytes<4> zlibChecksum = ToNativeRepresentation(std::bit_cast<Bytes<4>>(static_cast<std::uint32_t>(adler)));
+    segments.front().compressedBytes.insert(segments.front().compressedBytes.begin(), zlibHeader.begin(), zlibHeader.end());
+    segments.back().compressedBytes.insert(segments.back().compressedBytes.end(), zlibChecksum.begin(), zlibChecksum.end());
+
+    WriteBytes(stream, PNGSignature);
+
+    ChunkData<"IHDR"> header{ image.width, image.height, 8, colorType, 0, 0, InterlaceMethod::None };
+    std::array<Byte, ChunkTraits<"IHDR">::maxSize> headerData{};
+    {
+        auto width = ToNativeRepresentation(std::bit_cast<Bytes<4>>(header.width));
+        auto height = ToNativeRepresentation(std::bit_cast<Bytes<4>>(header.height));
+        std::copy(width.begin(), width.end(), headerData.begin());
+        std::copy(height.begin(), height.end(), headerData.begin() + 4);
+        headerData[8] = header.bitDepth;
+        headerData[9] = static_cast<Byte>(header.colorType);
+        headerData[10] = header.compressionMethod;
+        headerData[11] = header.filterMethod;
+        headerData[12] = static_cast<Byte>(header.interlaceMethod);
+    }
+    Writer::WriteChunk(stream, "IHDR", headerData);
+
+    if(emitSplitIndex)
+    {
+        std::vector<std::size_t> dataChunkSizes;
+        for(const Writer::Segment& segment : segments)
+        {
+            dataChunkSizes.push_back(Writer::DataChunksSize(segment.compressedBytes.size()));
+        }
+        Writer::WriteChunk(stream, ChunkTraits<"pdIX">::identifier, Writer::SplitIndex(dataChunkSizes, segments));
+    }
+
+    for(const Writer::Segment& segment : segments)
+    {
+        Writer::WriteDataChunks(stream, segment.compressedBytes);
+    }
+
+    Writer::WriteChunk(stream, "IEND", {});
+}
\ No newline at end of file
@@ -7,6 +7,13 @@
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_image.h>
 #include <filesystem>
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <zlib.h>
+#include "EmbeddedTestImages.h"
 
 import PNGParser;
 
@@ -31,6 +38,200 @@ void TestImageParser()
     }
 }
 
+template<const auto& PNGBytes>
+void TestEmbeddedImage(const std::string& file)
+{
+    std::fstream image{ file, std::ios::binary | std::ios::in };
+    image.exceptions(std::ios_base::badbit | std::ios_base::failbit);
+    Image2 runtimeImage = ParsePNG(image);
+
+    constexpr auto staticImage = ParseStaticPNG<PNGBytes>();
+    Image2 embeddedImage = ParseEmbeddedPNG<PNGBytes>();
+    Image2 fallbackImage = ParseEmbeddedPNG<PNGBytes, 0>();
+
+    auto matches = [&runtimeImage](const auto& image)
+    {
+        return image.width == runtimeImage.width && image.height == runtimeImage.height && image.pitch == runtimeImage.pitch && image.bitDepth == runtimeImage.bitDepth
+            && std::equal(image.imageBytes.begin(), image.imageBytes.end(), runtimeImage.imageBytes.begin(), runtimeImage.imageBytes.end());
+    };
+
+    std::cout << file << "\n";
+    std::cout << "Compile time decode matches runtime decode: " << matches(staticImage) << "\n";
+    std::cout << "Embedded decode matches runtime decode: " << matches(embeddedImage) << "\n";
+    std::cout << "Embedded runtime fallback matches runtime decode: " << matches(fallbackImage) << "\n";
+}
+
+void TestEmbeddedParser()
+{
+    //Non-interlaced 1 bit greyscale
+    TestEmbeddedImage<EmbeddedTestImages::basn0g01>("Test Images/basn0g01.png");
+    //Adam7 interlaced 2 bit palette
+    TestEmbeddedImage<EmbeddedTestImages::basi3p02>("Test Images/basi3p02.png");
+    //16 bit true color with alpha
+    TestEmbeddedImage<EmbeddedTestImages::basn6a16>("Test Images/basn6a16.png");
+}
+
+std::uint32_t ReadUInt32(const std::string& bytes, std::size_t position)
+{
+    std::uint32_t value = 0;
+    for(std::size_t i = 0; i < 4; i++)
+    {
+        value = (value << 8) | static_cast<std::uint8_t>(bytes[position + i]);
+    }
+    return value;
+}
+
+/// <summary>
+/// Inflates and defilters every segment listed in the pdIX chunk on its own, the way a parallel reader would
+/// </summary>
+/// <returns>The number of segments which matched the image, or -1 if the file has no index</returns>
+int DecodeIndexedSegments(const std::string& png, const Image2& image)
+{
+    constexpr std::size_t signatureSize = 8;
+    constexpr std::size_t chunkOverheadSize = 12;
+
+    std::size_t indexPosition = 0;
+    for(std::size_t position = signatureSize; position < png.size(); position += ReadUInt32(png, position) + chunkOverheadSize)
+    {
+        if(png.compare(position + 4, 4, "pdIX") == 0)
+        {
+            indexPosition = position;
+            break;
+        }
+    }
+
+    if(indexPosition == 0)
+        return -1;
+
+    const std::size_t bytesPerPixel = image.bitDepth / 8;
+    const std::size_t scanlineSize = image.width * bytesPerPixel;
+    const std::uint32_t segmentCount = ReadUInt32(png, indexPosition + 8);
+
+    int matchingSegments = 0;
+    for(std::uint32_t i = 0; i < segmentCount; i++)
+    {
+        const std::size_t entryPosition = indexPosition + 12 + i * 12;
+        const std::uint32_t firstRow = ReadUInt32(png, entryPosition);
+        const std::uint32_t rowCount = ReadUInt32(png, entryPosition + 4);
+        const std::uint32_t offset = ReadUInt32(png, entryPosition + 8);
+
+        std::string compressed;
+        for(std::size_t position = indexPosition + offset; png.compare(position + 4, 4, "IDAT") == 0; position += ReadUInt32(png, position) + chunkOverheadSize)
+        {
+            compressed.append(png, position + 8, ReadUInt32(png, position));
+        }
+
+        //Only the first segment starts with the zlib header, the rest are raw deflate
+        const std::size_t zlibHeaderSize = (i == 0) ? 2 : 0;
+        std::vector<std::uint8_t> filtered((scanlineSize + 1) * rowCount);
+
+        z_stream zstream = {};
+        inflateInit2(&zstream, -MAX_WBITS);
+        zstream.next_in = reinterpret_cast<Bytef*>(compressed.data() + zlibHeaderSize);
+        zstream.avail_in = static_cast<uInt>(compressed.size() - zlibHeaderSize);
+        zstream.next_out = filtered.data();
+        zstream.avail_out = static_cast<uInt>(filtered.size());
+        inflate(&zstream, Z_SYNC_FLUSH);
+        const bool inflated = zstream.avail_out == 0;
+        inflateEnd(&zstream);
+
+        if(!inflated)
+            continue;
+
+        //The first row of a segment must not depend on the previous segment, so it is defiltered against zeros
+        std::vector<std::uint8_t> previous(scanlineSize);
+        std::vector<std::uint8_t> current(scanlineSize);
+        bool matches = true;
+        for(std::uint32_t y = 0; y < rowCount && matches; y++)
+        {
+            const std::uint8_t filterType = filtered[y * (scanlineSize + 1)];
+            for(std::size_t x = 0; x < scanlineSize; x++)
+            {
+                const int a = (x >= bytesPerPixel) ? current[x - bytesPerPixel] : 0;
+                const int b = previous[x];
+                const int c = (x >= bytesPerPixel) ? previous[x - bytesPerPixel] : 0;
+                const int p = a + b - c;
+                const int paeth = (std::abs(p - a) <= std::abs(p - b) && std::abs(p - a) <= std::abs(p - c)) ? a : (std::abs(p - b) <= std::abs(p - c)) ? b : c;
+                const int predictors[] = { 0, a, b, (a + b) / 2, paeth };
+                current[x] = static_cast<std::uint8_t>(filtered[y * (scanlineSize + 1) + 1 + x] + predictors[filterType]);
+            }
+
+            auto row = image.imageBytes.begin() + static_cast<std::size_t>(firstRow + y) * image.pitch;
+            matches = std::equal(current.begin(), current.end(), row);
+            std::swap(previous, current);
+        }
+
+        matchingSegments += matches;
+    }
+
+    return matchingSegments;
+}
+
+/// <summary>
+/// Decodes with SDL_image so the writer is not only checked against this library's reader
+/// </summary>
+bool MatchesSDLImage(const std::string& png, const Image2& image)
+{
+    SDL_Surface* loaded = IMG_Load_RW(SDL_RWFromConstMem(png.data(), static_cast<int>(png.size())), 1);
+    if(loaded == nullptr)
+        return false;
+
+    SDL_Surface* surface = SDL_ConvertSurfaceFormat(loaded, (image.bitDepth == 32) ? SDL_PIXELFORMAT_RGBA32 : SDL_PIXELFORMAT_RGB24, 0);
+    SDL_FreeSurface(loaded);
+    if(surface == nullptr)
+        return false;
+
+    bool matches = surface->w == image.width && surface->h == image.height;
+    for(int y = 0; y < image.height && matches; y++)
+    {
+        const std::uint8_t* row = static_cast<const std::uint8_t*>(surface->pixels) + y * surface->pitch;
+        matches = std::equal(row, row + image.width * image.bitDepth / 8, image.imageBytes.begin() + y * image.pitch);
+    }
+
+    SDL_FreeSurface(surface);
+    return matches;
+}
+
+void TestImageWriter()
+{
+    std::fstream image{ "Test Images/basn6a08.png", std::ios::binary | std::ios::in };
+    image.exceptions(std::ios_base::badbit | std::ios_base::failbit);
+    Image2 tile = ParsePNG(image);
+
+    //Tile the test image into something large enough to be split across threads
+    Image2 largeImage{ tile.width * 64, tile.height * 64, {}, tile.pitch * 64, tile.bitDepth };
+    largeImage.imageBytes.resize(static_cast<std::size_t>(largeImage.pitch) * largeImage.height);
+    for(int y = 0; y < largeImage.height; y++)
+    {
+        for(int x = 0; x < 64; x++)
+        {
+            auto row = tile.imageBytes.begin() + (y % tile.height) * tile.pitch;
+            std::copy(row, row + tile.pitch, largeImage.imageBytes.begin() + y * largeImage.pitch + x * tile.pitch);
+        }
+    }
+
+    for(bool emitSplitIndex : { true, false })
+    {
+        for(unsigned int threadCount : { 1u, 4u })
+        {
+            std::stringstream stream{ std::ios::binary | std::ios::in | std::ios::out };
+            stream.exceptions(std::ios_base::badbit | std::ios_base::failbit);
+
+            auto timePoint = std::chrono::steady_clock::now();
+            WritePNG(stream, largeImage, { .threadCount = threadCount, .emitSplitIndex = emitSplitIndex });
+            auto end = std::chrono::steady_clock::now();
+
+            std::string png = stream.str();
+            Image2 readImage = ParsePNG(stream);
+
+            std::cout << "Split index: " << emitSplitIndex << " Threads: " << threadCount << " Time taken to write: " << std::chrono::duration_cast<std::chrono::milliseconds>(end - timePoint)
+                << " Size: " << png.size() << "\n";
+            std::cout << "Round trip matches: " << (readImage.imageBytes == largeImage.imageBytes) << " SDL_image matches: " << MatchesSDLImage(png, largeImage)
+                << " Independently decoded segments matching: " << DecodeIndexedSegments(png, largeImage) << "\n";
+        }
+    }
+}
+
 void OutputTest(std::string file)
 {
     std::fstream image { file, std::ios::binary | std::ios::in };
@@ -78,6 +279,8 @@ void OutputTest(std::string file)
 int main()
 {
     TestImageParser();
+    TestEmbeddedParser();
+    TestImageWriter();
     //OutputTest("Test Images/ps1n0g08.png");
     return 0;
 }
@@ -0,0 +1,411 @@
+module;
+
+#include <cstdint>
+#include <array>
+#include <span>
+#include <vector>
+#include <stdexcept>
+#include <algorithm>
+#include <utility>
+
+export module PNGParser:StaticDecoder;
+import :PlatformDetection;
+import :ChunkData;
+import :ColorTypeDescription;
+import :Image;
+import :PNGFilter0;
+import :Adam7;
+import :Inflate;
+
+//constexpr counterpart of ParsePNG for images that are embedded in the binary.
+//Produces the same pixel layout as ParsePNG, so the result can be used in its place
+namespace StaticDecoder
+{
+    struct ChunkView
+    {
+        ChunkType type;
+        std::span<const Byte> data;
+    };
+
+    constexpr std::uint32_t ReadUInt32(std::span<const Byte> bytes) noexcept
+    {
+        return (std::uint32_t{ bytes[0] } << 24) | (std::uint32_t{ bytes[1] } << 16) | (std::uint32_t{ bytes[2] } << 8) | std::uint32_t{ bytes[3] };
+    }
+
+    constexpr std::array<std::uint32_t, 256> crcTable = []
+    {
+        std::array<std::uint32_t, 256> table{};
+        for(std::uint32_t i = 0; i < table.size(); i++)
+        {
+            std::uint32_t crc = i;
+            for(size_t bit = 0; bit < 8; bit++)
+            {
+                crc = (crc & 1) ? 0xedb88320 ^ (crc >> 1) : crc >> 1;
+            }
+            table[i] = crc;
+        }
+        return table;
+    }();
+
+    /// <summary>
+    /// CRC of the chunk type and chunk data, as stored after every chunk
+    /// </summary>
+    constexpr std::uint32_t ChunkCRC(std::span<const Byte> typeAndData) noexcept
+    {
+        std::uint32_t crc = 0xffffffff;
+        for(Byte byte : typeAndData)
+        {
+            crc = crcTable[(crc ^ byte) & 0xff] ^ (crc >> 8);
+        }
+        return crc ^ 0xffffffff;
+    }
+
+    constexpr size_t chunkLengthSize = 4;
+    constexpr size_t chunkTypeSize = 4;
+    constexpr size_t chunkCRCSize = 4;
+
+    constexpr void VerifySignature(std::span<const Byte> pngBytes)
+    {
+        if(pngBytes.size() < PNGSignature.size() || !std::equal(PNGSignature.begin(), PNGSignature.end(), pngBytes.begin()))
+            throw std::runtime_error("PNG signature could not be matched");
+    }
+
+    /// <summary>
+    /// Reads the chunk at the start of bytes, verifying its CRC
+    /// </summary>
+    /// <returns>The chunk and the bytes following it</returns>
+    constexpr std::pair<ChunkView, std::span<const Byte>> ReadChunk(std::span<const Byte> bytes)
+    {
+        if(bytes.size() < chunkLengthSize + chunkTypeSize + chunkCRCSize)
+            throw std::runtime_error("Unexpected end of PNG data");
+
+        std::uint32_t chunkSize = ReadUInt32(bytes);
+        if(chunkSize > bytes.size() - chunkLengthSize - chunkTypeSize - chunkCRCSize)
+            throw std::runtime_error("Chunk size exceeds the remaining PNG data");
+
+        std::span<const Byte> typeAndData = bytes.subspan(chunkLengthSize, chunkTypeSize + chunkSize);
+        if(ChunkCRC(typeAndData) != ReadUInt32(bytes.subspan(chunkLengthSize + chunkTypeSize + chunkSize)))
+            throw std::runtime_error("Chunk CRC does not match");
+
+        Bytes<4> typeBytes{};
+        std::copy_n(typeAndData.begin(), typeBytes.size(), typeBytes.begin());
+        return { { ChunkType{ typeBytes }, typeAndData.subspan(chunkTypeSize) }, bytes.subspan(chunkLengthSize + chunkTypeSize + chunkSize + chunkCRCSize) };
+    }
+
+    /// <summary>
+    /// Splits a PNG file into its chunks up to and including IEND, verifying the signature and every chunk's CRC
+    /// </summary>
+    constexpr std::vector<ChunkView> ReadChunks(std::span<const Byte> pngBytes)
+    {
+        VerifySignature(pngBytes);
+
+        std::vector<ChunkView> chunks;
+        std::span<const Byte> remaining = pngBytes.subspan(PNGSignature.size());
+        while(chunks.empty() || chunks.back().type != "IEND")
+        {
+            auto [chunk, next] = ReadChunk(remaining);
+            chunks.push_back(chunk);
+            remaining = next;
+        }
+
+        return chunks;
+    }
+
+    constexpr ChunkData<"IHDR"> ParseHeader(std::span<const Byte> data)
+    {
+        if(data.size() != ChunkTraits<"IHDR">::maxSize)
+            throw std::runtime_error("IHDR data does not match the expected size");
+
+        ChunkData<"IHDR"> header{};
+        header.width = static_cast<std::int32_t>(ReadUInt32(data));
+        header.height = static_cast<std::int32_t>(ReadUInt32(data.subspan(4)));
+        header.bitDepth = static_cast<std::int8_t>(data[8]);
+        header.colorType = static_cast<ColorType>(data[9]);
+        header.compressionMethod = static_cast<std::int8_t>(data[10]);
+        header.filterMethod = static_cast<std::int8_t>(data[11]);
+        header.interlaceMethod = static_cast<InterlaceMethod>(data[12]);
+
+        if(header.width <= 0 || header.height <= 0)
+            throw std::runtime_error("Image dimensions must be positive");
+
+        auto format = std::find_if(standardColorFormats.begin(), standardColorFormats.end(), [&header](const ColorFormatView& format) { return format.type == header.colorType; });
+        if(format == standardColorFormats.end())
+            throw std::runtime_error("Unexpected color type");
+        if(std::find(format->allowBitDepths.begin(), format->allowBitDepths.end(), header.bitDepth) == format->allowBitDepths.end())
+            throw std::runtime_error("Unsupported bit depth for color type");
+        if(header.compressionMethod != 0)
+            throw std::runtime_error("Unknown compression method");
+        if(header.filterMethod != 0)
+            throw std::runtime_error("Unknown filter type");
+        if(header.interlaceMethod != InterlaceMethod::None && header.interlaceMethod != InterlaceMethod::Adam7)
+            throw std::runtime_error("Unknown interlace method");
+
+        return header;
+    }
+
+    /// <summary>
+    /// Only reads as far as the header so its cost does not depend on the size of the image
+    /// </summary>
+    constexpr ChunkData<"IHDR"> ReadHeader(std::span<const Byte> pngBytes)
+    {
+        VerifySignature(pngBytes);
+
+        ChunkView header = ReadChunk(pngBytes.subspan(PNGSignature.size())).first;
+        if(header.type != "IHDR")
+            throw std::runtime_error("Header chunk not found");
+
+        return ParseHeader(header.data);
+    }
+
+    /// <summary>
+    /// Subpixels per pixel of the decoded image, true color stays RGB while everything else becomes RGBA
+    /// </summary>
+    constexpr std::int8_t DecodedSubpixelCount(const ChunkData<"IHDR">& header) noexcept
+    {
+        return (header.colorType == ColorType::TrueColor) ? 3 : 4;
+    }
+
+    constexpr std::size_t DecodedImageSize(const ChunkData<"IHDR">& header) noexcept
+    {
+        return static_cast<std::size_t>(header.width) * header.height * DecodedSubpixelCount(header);
+    }
+
+    struct Pass
+    {
+        ImageInfo info;
+        std::int32_t startingRow;
+        std::int32_t startingCol;
+        std::int32_t rowIncrement;
+        std::int32_t columnIncrement;
+    };
+
+    constexpr std::vector<Pass> Passes(const ChunkData<"IHDR">& header)
+    {
+        ImageInfo info = header.ToImageInfo();
+
+        std::vector<Pass> passes;
+        if(header.interlaceMethod == InterlaceMethod::None)
+        {
+            passes.push_back({ info, 0, 0, 1, 1 });
+            return passes;
+        }
+
+        for(size_t i = 0; i < Adam7::passCount; i++)
+        {
+            if(!Adam7::Internal::Exists(info.width, info.height, i))
+                continue;
+
+            ImageInfo passInfo{ info.pixelInfo, Adam7::Internal::Width(info.width, i), Adam7::Internal::Height(info.height, i) };
+            passes.push_back({ passInfo, Adam7::startingRow[i], Adam7::startingCol[i], Adam7::rowIncrement[i], Adam7::columnIncrement[i] });
+        }
+        return passes;
+    }
+
+    /// <summary>
+    /// Reverses filter method 0 in place, filteredBytes holds every scanline of the pass including its filter byte
+    /// </summary>
+    constexpr void DefilterPass(std::span<Byte> filteredBytes, const ImageInfo& info)
+    {
+        const std::size_t scanlineSize = info.ScanlineSize();
+        //Filters operate on whole bytes, so sub-byte pixels compare against the previous byte
+        const std::size_t bytesPerPixel = std::max<std::size_t>(1, info.pixelInfo.BitsPerPixel() / 8);
+
+        std::span<const Byte> previousScanline;
+        for(std::int32_t y = 0; y < info.height; y++)
+        {
+            std::span<Byte> scanline = filteredBytes.subspan(y * Filter0::ScanlineSize(info), Filter0::ScanlineSize(info));
+            Byte filterByte = scanline[0];
+            if(filterByte >= Filter0::numFilterFunctions)
+                throw std::runtime_error("Unexpected filter type");
+
+            Filter0::FilterFunctionSignature defilter = Filter0::defilterFunctions[filterByte];
+            std::span<Byte> bytes = scanline.subspan(Filter0::filterByteCount, scanlineSize);
+            for(size_t i = 0; i < bytes.size(); i++)
+            {
+                Byte a = (i >= bytesPerPixel) ? bytes[i - bytesPerPixel] : 0;
+                Byte b = previousScanline.empty() ? 0 : previousScanline[i];
+                Byte c = (i >= bytesPerPixel && !previousScanline.empty()) ? previousScanline[i - bytesPerPixel] : 0;
+                bytes[i] = defilter(bytes[i], a, b, c);
+            }
+
+            previousScanline = bytes;
+        }
+    }
+
+    /// <summary>
+    /// Reads a subpixel and scales it to 8 bits the same way ParsePNG does, palette indices are left unscaled
+    /// </summary>
+    constexpr Byte ReadSubpixel(std::span<const Byte> scanline, const ChunkData<"IHDR">& header, std::size_t subpixelIndex)
+    {
+        switch(header.bitDepth)
+        {
+        case 1:
+        case 2:
+        case 4:
+        {
+            const std::size_t subpixelPerByte = 8 / header.bitDepth;
+            const std::size_t shift = 8 - header.bitDepth * (subpixelIndex % subpixelPerByte + 1);
+            const Byte value = (scanline[subpixelIndex / subpixelPerByte] >> shift) & ((1 << header.bitDepth) - 1);
+
+            if(header.colorType == ColorType::IndexedColor)
+                return value;
+
+            return value * (255 / ((1 << header.bitDepth) - 1));
+        }
+        case 8:
+            return scanline[subpixelIndex];
+        case 16:
+        {
+            std::uint32_t value = (scanline[subpixelIndex * 2] << 8) | scanline[subpixelIndex * 2 + 1];
+            return static_cast<Byte>(value * 255 / 65535);
+        }
+        }
+
+        throw std::runtime_error("Unsupported bit depth");
+    }
+
+    constexpr void WritePixel(std::span<Byte> pixel, std::span<const Byte> scanline, std::int32_t x, const ChunkData<"IHDR">& header, const ChunkData<"PLTE">* palette)
+    {
+        const std::size_t subpixelCount = header.SubpixelCount();
+        auto subpixel = [&](std::size_t i) { return ReadSubpixel(scanline, header, x * subpixelCount + i); };
+
+        switch(header.colorType)
+        {
+        case ColorType::GreyScale:
+            pixel[0] = pixel[1] = pixel[2] = subpixel(0);
+            pixel[3] = 255;
+            break;
+        case ColorType::TrueColor:
+            pixel[0] = subpixel(0);
+            pixel[1] = subpixel(1);
+            pixel[2] = subpixel(2);
+            break;
+        case ColorType::IndexedColor:
+        {
+            if(palette == nullptr)
+                throw std::runtime_error("Indexed color image has no palette");
+
+            const ChunkData<"PLTE">::ColorEntry& color = palette->colorPalette[subpixel(0)];
+            std::copy(color.begin(), color.end(), pixel.begin());
+            pixel[3] = 255;
+        }
+        break;
+        case ColorType::GreyscaleWithAlpha:
+            pixel[0] = pixel[1] = pixel[2] = subpixel(0);
+            pixel[3] = subpixel(1);
+            break;
+        case ColorType::TruecolorWithAlpha:
+            pixel[0] = subpixel(0);
+            pixel[1] = subpixel(1);
+            pixel[2] = subpixel(2);
+            pixel[3] = subpixel(3);
+            break;
+        }
+    }
+
+    /// <summary>
+    /// Fully decodes a PNG file, the result is DecodedImageSize(header) bytes laid out the same as ParsePNG's image bytes
+    /// </summary>
+    constexpr std::vector<Byte> Decode(std::span<const Byte> pngBytes)
+    {
+        std::vector<ChunkView> chunks = ReadChunks(pngBytes);
+        if(chunks.front().type != "IHDR")
+            throw std::runtime_error("Header chunk not found");
+
+        const ChunkData<"IHDR"> header = ParseHeader(chunks.front().data);
+
+        std::vector<Byte> compressedBytes;
+        ChunkData<"PLTE"> palette{};
+        bool hasPalette = false;
+        for(const ChunkView& chunk : chunks)
+        {
+            if(chunk.type == "IDAT")
+            {
+                compressedBytes.insert(compressedBytes.end(), chunk.data.begin(), chunk.data.end());
+            }
+            else if(chunk.type == "PLTE")
+            {
+                if(chunk.data.size() % 3 > 0 || chunk.data.size() > ChunkTraits<"PLTE">::maxEntries * 3)
+                    throw std::runtime_error("PLTE data exceeds the expected size");
+
+                for(size_t i = 0; i < chunk.data.size(); i++)
+                {
+                    palette.colorPalette[i / 3][i % 3] = chunk.data[i];
+                }
+                hasPalette = true;
+            }
+        }
+
+        if(compressedBytes.empty())
+            throw std::runtime_error("No data chunks found");
+
+        const std::vector<Pass> passes = Passes(header);
+        std::size_t filteredSize = 0;
+        for(const Pass& pass : passes)
+        {
+            filteredSize += Filter0::ImageSize(pass.info);
+        }
+
+        std::vector<Byte> filteredBytes = Inflate::Decompress(compressedBytes, filteredSize);
+        if(filteredBytes.size() != filteredSize)
+            throw std::runtime_error("size does not match");
+
+        const std::size_t subpixelCount = DecodedSubpixelCount(header);
+        const std::size_t pitch = header.width * subpixelCount;
+
+        std::vector<Byte> imageBytes(DecodedImageSize(header));
+        std::span<Byte> remaining = filteredBytes;
+        for(const Pass& pass : passes)
+        {
+            std::span<Byte> passBytes = remaining.first(Filter0::ImageSize(pass.info));
+            remaining = remaining.subspan(passBytes.size());
+
+            DefilterPass(passBytes, pass.info);
+
+            for(std::int32_t y = 0; y < pass.info.height; y++)
+            {
+                std::span<const Byte> scanline = passBytes.subspan(y * Filter0::ScanlineSize(pass.info) + Filter0::filterByteCount, pass.info.ScanlineSize());
+                std::size_t row = pass.startingRow + y * pass.rowIncrement;
+                for(std::int32_t x = 0; x < pass.info.width; x++)
+                {
+                    std::size_t column = pass.startingCol + x * pass.columnIncrement;
+                    std::span<Byte> pixel = std::span(imageBytes).subspan(row * pitch + column * subpixelCount, subpixelCount);
+                    WritePixel(pixel, scanline, x, header, hasPalette ? &palette : nullptr);
+                }
+            }
+        }
+
+        return imageBytes;
+    }
+}
+
+/// <summary>
+/// Decoded image whose dimensions are known at compile time, members mirror Image2
+/// </summary>
+export template<std::int32_t Width, std::int32_t Height, std::int8_t SubpixelCount>
+struct StaticImage
+{
+    static constexpr int width = Width;
+    static constexpr int height = Height;
+    static constexpr int pitch = Width * SubpixelCount;
+    static constexpr int bitDepth = SubpixelCount * 8;
+
+    std::array<Byte, static_cast<std::size_t>(pitch) * Height> imageBytes;
+};
+
+/// <summary>
+/// Decodes a PNG embedded in the binary at compile time. Malformed images fail to compile.
+/// Usage: static constexpr Byte icon[] = { #embed "icon.png" }; constexpr auto image = ParseStaticPNG<icon>();
+/// Compile time decoding is bound by the compiler's constexpr step limit (/constexpr:steps on MSVC),
+/// ParseEmbeddedPNG falls back to decoding at runtime for larger images
+/// </summary>
+export template<const auto& PNGBytes>
+consteval auto ParseStaticPNG()
+{
+    constexpr ChunkData<"IHDR"> header = StaticDecoder::ReadHeader(PNGBytes);
+
+    StaticImage<header.width, header.height, StaticDecoder::DecodedSubpixelCount(header)> image{};
+    std::vector<Byte> imageBytes = StaticDecoder::Decode(PNGBytes);
+    std::copy(imageBytes.begin(), imageBytes.end(), image.imageBytes.begin());
+    return image;
+}
\ No newline at end of file